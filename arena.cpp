@@ -0,0 +1,137 @@
+/**
+ * @file arena.cpp
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#include "arena.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace ar {
+
+    namespace {
+
+        // Smallest block taken from the heap when the arena has to grow on its own
+        constexpr size_t sizMinBlockBytes = (64 * 1024);
+
+    }
+
+    clsArena::clsArena(
+        clsArena&& objArenaOther
+    ) noexcept {
+        *this = std::move(objArenaOther);
+    }
+
+    clsArena&
+        clsArena::operator=(
+            clsArena&& objArenaOther
+            ) noexcept {
+        if (this != &objArenaOther) {
+            release();
+            std::swap(vctStcBlocks, objArenaOther.vctStcBlocks);
+            std::swap(sizBlockIdx, objArenaOther.sizBlockIdx);
+            std::swap(sizOffsetBytes, objArenaOther.sizOffsetBytes);
+            std::swap(sizUsedBytes, objArenaOther.sizUsedBytes);
+            std::swap(sizCapacityBytes, objArenaOther.sizCapacityBytes);
+            std::swap(u64NumAllocations, objArenaOther.u64NumAllocations);
+        }
+        return *this;
+    }
+
+    void
+        clsArena::reserve(
+            size_t const sizBytes
+        ) {
+        if (vctStcBlocks.size() > sizBlockIdx) {
+            stcBlockType const& stcBlock = vctStcBlocks[sizBlockIdx];
+            size_t const sizBegin = getPaddedSize(sizOffsetBytes);
+            if ((stcBlock.sizBytes >= sizBegin) && ((stcBlock.sizBytes - sizBegin) >= sizBytes)) {
+                return;
+            }
+        }
+
+        if (0 == sizUsedBytes) {
+            // Nothing handed out yet, so the undersized memory can simply be replaced
+            release();
+        }
+        addBlock(sizBytes);
+    }
+
+    void
+        clsArena::reset(
+            void
+        ) {
+        if (1 < vctStcBlocks.size()) {
+            // Merge into one block of the same total size (enough for everything handed out)
+            size_t const sizNeededBytes = sizCapacityBytes;
+            release();
+            addBlock(sizNeededBytes);
+        }
+        sizBlockIdx = 0;
+        sizOffsetBytes = 0;
+        sizUsedBytes = 0;
+    }
+
+    void
+        clsArena::release(
+            void
+        ) {
+        vctStcBlocks.clear();
+        vctStcBlocks.shrink_to_fit();
+        sizBlockIdx = 0;
+        sizOffsetBytes = 0;
+        sizUsedBytes = 0;
+        sizCapacityBytes = 0;
+    }
+
+    void*
+        clsArena::allocateBytes(
+            size_t const sizBytes
+        ) {
+        while (true) {
+            if (vctStcBlocks.size() <= sizBlockIdx) {
+                // Grow geometrically (each new block at least doubles the capacity)
+                addBlock(std::max({ sizBytes, sizCapacityBytes, sizMinBlockBytes }));
+            }
+
+            stcBlockType const& stcBlock = vctStcBlocks[sizBlockIdx];
+            size_t const sizBegin = getPaddedSize(sizOffsetBytes);
+            if ((stcBlock.sizBytes >= sizBegin) && ((stcBlock.sizBytes - sizBegin) >= sizBytes)) {
+                sizUsedBytes += getPaddedSize(sizBytes);
+                sizOffsetBytes = (sizBegin + sizBytes);
+                return (stcBlock.ptrBytes + sizBegin);
+            }
+
+            // The rest of this block is too small; move on to the next one
+            ++sizBlockIdx;
+            sizOffsetBytes = 0;
+        }
+    }
+
+    void
+        clsArena::addBlock(
+            size_t const sizBytes
+        ) {
+        // Over-allocate so the usable bytes can start on an alignment boundary
+        stcBlockType stcBlock{};
+        stcBlock.ptrBytesOwned.reset(new std::byte[sizBytes + sizAlignBytes]);
+        uintptr_t const uptrRaw = reinterpret_cast<uintptr_t>(stcBlock.ptrBytesOwned.get());
+        uintptr_t const uptrAligned = ((uptrRaw + (sizAlignBytes - 1)) & ~static_cast<uintptr_t>(sizAlignBytes - 1));
+        stcBlock.ptrBytes = (stcBlock.ptrBytesOwned.get() + (uptrAligned - uptrRaw));
+        stcBlock.sizBytes = sizBytes;
+
+        if (vctStcBlocks.size() > sizBlockIdx) {
+            // Continue in the new block (allocations already made stay where they are)
+            sizBlockIdx = vctStcBlocks.size();
+            sizOffsetBytes = 0;
+        }
+        vctStcBlocks.push_back(std::move(stcBlock));
+        sizCapacityBytes += sizBytes;
+        ++u64NumAllocations;
+    }
+
+}
@@ -0,0 +1,142 @@
+/**
+ * @file arena.h
+ * @brief Bump-pointer memory arena for data that shares a single lifetime.
+ *
+ * Every allocation made from an arena is released at once, either when the arena is reset (its
+ * memory is kept for reuse) or when it is destroyed. Parsing records of the same shape over and
+ * over through one arena therefore settles on a single block and stops touching the heap.
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "types.h"
+
+namespace ar {
+
+    class clsArena {
+
+    public:
+        // Alignment of every allocation (a cache line, so neighbouring arrays never share one)
+        static constexpr size_t sizAlignBytes = 64;
+
+        clsArena() {}
+
+        // The memory is owned by exactly one instance
+        clsArena(clsArena const&) = delete;
+        clsArena& operator=(clsArena const&) = delete;
+
+        clsArena(
+            clsArena&& objArenaOther
+        ) noexcept;
+
+        clsArena&
+            operator=(
+                clsArena&& objArenaOther
+                ) noexcept;
+
+        // Bytes one allocation of `sizBytes` takes up in a block (for sizing `reserve`)
+        static constexpr size_t
+            getPaddedSize(
+                size_t const sizBytes
+            ) {
+            return ((sizBytes + (sizAlignBytes - 1)) & ~(sizAlignBytes - 1));
+        }
+
+        // Uninitialized storage for `sizCount` objects (valid until the next `reset` or `release`)
+        template <typename typValueType>
+        typValueType*
+            allocate(
+                size_t const sizCount
+            ) {
+            static_assert(
+                std::is_trivially_copyable<typValueType>::value && std::is_trivially_destructible<typValueType>::value,
+                "arena storage is never destroyed, so it may only hold trivial types"
+                );
+            static_assert(sizAlignBytes >= alignof(typValueType), "over-aligned type");
+            return static_cast<typValueType*>(allocateBytes(sizCount * sizeof(typValueType)));
+        }
+
+        // Make sure at least `sizBytes` (summed over `getPaddedSize` of each allocation) can be
+        // allocated before the heap is touched again
+        void
+            reserve(
+                size_t const sizBytes
+            );
+
+        // Release every allocation at once, keeping the memory for reuse
+        //
+        // If the previous allocations spilled over into more than one block, the blocks are merged
+        // into a single one of the same total size.
+        void
+            reset(
+                void
+            );
+
+        // Release every allocation and return the memory to the heap
+        void
+            release(
+                void
+            );
+
+        // Bytes handed out since the last reset (each allocation rounded up by `getPaddedSize`)
+        size_t
+            used(
+                void
+            ) const {
+            return sizUsedBytes;
+        }
+
+        // Bytes held from the heap
+        size_t
+            capacity(
+                void
+            ) const {
+            return sizCapacityBytes;
+        }
+
+        // Blocks taken from the heap over the lifetime of the arena
+        uint64_t
+            allocations(
+                void
+            ) const {
+            return u64NumAllocations;
+        }
+
+    private:
+        struct stcBlockType {
+            std::unique_ptr<std::byte[]> ptrBytesOwned;
+            // first aligned byte within the owned bytes, and usable bytes from it
+            std::byte* ptrBytes;
+            size_t sizBytes;
+        };
+
+        void*
+            allocateBytes(
+                size_t const sizBytes
+            );
+
+        void
+            addBlock(
+                size_t const sizBytes
+            );
+
+        std::vector<stcBlockType> vctStcBlocks;
+        // Bump pointer (current block and offset of its first free byte)
+        size_t sizBlockIdx = 0;
+        size_t sizOffsetBytes = 0;
+
+        size_t sizUsedBytes = 0;
+        size_t sizCapacityBytes = 0;
+        uint64_t u64NumAllocations = 0;
+
+    };
+
+}
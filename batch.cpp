@@ -0,0 +1,75 @@
+/**
+ * @file batch.cpp
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#include "batch.h"
+
+#include <mutex>
+#include <utility>
+
+#include "threadPool.h"
+
+namespace batch {
+
+    error::enmErrorType
+        parseRecords(
+            std::vector<std::string> const& vctStrFileNamePrefixes,
+            stcBatchOptionsType const& stcOpts,
+            fcnResultType const& fcnOnResult
+        ) {
+        if (!fcnOnResult) {
+            return error::enmErrorInvalidArg;
+        }
+
+        size_t const sizNumThreads = tp::resolveNumThreads(stcOpts.u32NumThreads);
+        std::mutex objMtxResult;
+
+        // Each record is one task; a large data file splits into chunk tasks of its own (see
+        // `parseDataFile`), which idle workers steal from the worker parsing it
+        tp::clsThreadPool::getShared().parallelFor(
+            vctStrFileNamePrefixes.size(),
+            sizNumThreads,
+            [&vctStrFileNamePrefixes, &stcOpts, &fcnOnResult, &objMtxResult](size_t const sizIdx) {
+                stcBatchResultType stcResult{};
+                stcResult.sizIndex = sizIdx;
+                stcResult.strFileNamePrefix = vctStrFileNamePrefixes[sizIdx];
+
+                comtrade::stcParseOptionsType stcParseOpts{};
+                stcParseOpts.u32NumThreads = stcOpts.u32NumThreadsPerRecord;
+                stcParseOpts.bLazy = stcOpts.bLazy;
+                stcParseOpts.ptrStcStats = &stcResult.stcStats;
+
+                stcResult.enmErr = comtrade::parseConfigFile(stcResult.strFileNamePrefix, stcResult.stcCfg);
+                if (error::enmErrorNone == stcResult.enmErr) {
+                    stcResult.enmErr = comtrade::parseDataFile(stcResult.stcCfg, stcResult.stcDat, stcParseOpts);
+                }
+
+                std::lock_guard<std::mutex> const objLock(objMtxResult);
+                fcnOnResult(stcResult);
+            }
+        );
+
+        return error::enmErrorNone;
+    }
+
+    error::enmErrorType
+        parseRecords(
+            std::vector<std::string> const& vctStrFileNamePrefixes,
+            stcBatchOptionsType const& stcOpts,
+            std::vector<stcBatchResultType>& vctStcResultsOut
+        ) {
+        vctStcResultsOut.clear();
+        vctStcResultsOut.resize(vctStrFileNamePrefixes.size());
+        return parseRecords(
+            vctStrFileNamePrefixes,
+            stcOpts,
+            [&vctStcResultsOut](stcBatchResultType& stcResult) {
+                vctStcResultsOut[stcResult.sizIndex] = std::move(stcResult);
+            }
+        );
+    }
+
+}
@@ -0,0 +1,71 @@
+/**
+ * @file batch.h
+ * @brief Concurrent parsing of many COMTRADE records (e.g., every record of an event folder).
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "comtrade.h"
+#include "error.h"
+#include "types.h"
+
+namespace batch {
+
+    struct stcBatchOptionsType {
+        // Records parsed at once (0 --> one per hardware thread, 1 --> serial)
+        uint32_t u32NumThreads = 0;
+
+        // Worker threads a single data file may be split across (0 --> one per hardware thread);
+        // only binary data files large enough to be split into several chunks are affected
+        uint32_t u32NumThreadsPerRecord = 0;
+
+        // See `comtrade::stcParseOptionsType::bLazy`
+        bool bLazy = false;
+    };
+
+    // One parsed record (`stcCfg` and `stcDat` are only valid on success)
+    struct stcBatchResultType {
+        // position of the record in the list passed in
+        size_t sizIndex;
+        std::string strFileNamePrefix;
+
+        error::enmErrorType enmErr;
+
+        comtrade::stcConfigFileType stcCfg;
+        comtrade::stcDataFileType stcDat;
+        comtrade::stcParseStatsType stcStats;
+    };
+
+    // Receives each record as soon as it is parsed, in completion order; calls never overlap,
+    // but come from worker threads. The record may be moved out, otherwise it is freed on return.
+    typedef std::function<void(stcBatchResultType&)> fcnResultType;
+
+    // Parse the configuration and data file of every record (`strFileNamePrefix` as for
+    // `comtrade::parseConfigFile`) on the shared work-stealing pool
+    //
+    // A record that fails to parse is still reported, carrying its error. Blocks until every
+    // record has been reported.
+    error::enmErrorType
+        parseRecords(
+            std::vector<std::string> const& vctStrFileNamePrefixes,
+            stcBatchOptionsType const& stcOpts,
+            fcnResultType const& fcnOnResult
+        );
+
+    // As above, collecting the results in input order
+    error::enmErrorType
+        parseRecords(
+            std::vector<std::string> const& vctStrFileNamePrefixes,
+            stcBatchOptionsType const& stcOpts,
+            std::vector<stcBatchResultType>& vctStcResultsOut
+        );
+
+}
@@ -0,0 +1,514 @@
+/**
+ * @file bench.cpp
+ * @brief Parser benchmarks over deterministic synthetic records.
+ *
+ * Each scenario is written to a temporary directory as a .CFG/.DAT pair, then every benchmark runs
+ * repeatedly until it has taken at least the minimum time. Throughput is reported in MB/s of input
+ * and items/s (samples for parsing and sample lookups, lookups for the channel and time lookups),
+ * with the peak resident set size of the process after each benchmark.
+ *
+ * Usage: cpp-comtrade-bench [--filter <text>] [--min-time <seconds>] [--threads <n>] [--dir <path>]
+ *                           [--keep] [--format ascii|binary|binary32|float32] [--ana <n>] [--dig <n>]
+ *                           [--samples <n>] [--rate <Hz>] [--seed <n>]
+ *
+ * Any of the record options replaces the built-in scenarios with a single custom one.
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "comtrade.h"
+#include "decode.h"
+#include "diag.h"
+#include "error.h"
+#include "stats.h"
+#include "synthetic.h"
+#include "types.h"
+#include "utils.h"
+
+namespace {
+
+    struct stcScenarioType {
+        std::string strName;
+        synth::stcSyntheticRecordType stcRecord;
+    };
+
+    struct stcBenchmarkType {
+        std::string strName;
+        // input bytes and items (samples or lookups) processed by one iteration
+        uint64_t u64BytesPerIter;
+        uint64_t u64ItemsPerIter;
+        std::function<error::enmErrorType(void)> fcnRun;
+    };
+
+    struct stcBenchOptionsType {
+        std::string strFilter;
+        float64_t f64MinTimeSec = 0.5;
+        uint32_t u32NumThreads = 0;
+        std::string strDir;
+        bool bKeep = false;
+    };
+
+    // Keeps results alive so the optimizer cannot drop the work that produced them
+    volatile float64_t f64Sink = 0.0;
+
+    uint64_t
+        getPeakRssBytes(
+            void
+        ) {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS objPmc{};
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &objPmc, sizeof(objPmc))) {
+            return 0;
+        }
+        return static_cast<uint64_t>(objPmc.PeakWorkingSetSize);
+#else
+        struct rusage objRusage {};
+        if (0 != getrusage(RUSAGE_SELF, &objRusage)) {
+            return 0;
+        }
+#if defined(__APPLE__)
+        return static_cast<uint64_t>(objRusage.ru_maxrss);
+#else
+        return (static_cast<uint64_t>(objRusage.ru_maxrss) * 1024);
+#endif
+#endif
+    }
+
+    char const*
+        getSimdName(
+            decode::enmSimdLevelType const enmSimdLevel
+        ) {
+        switch (enmSimdLevel) {
+        case decode::enmSimdLevelAvx2:
+            return "AVX2";
+        case decode::enmSimdLevelSse2:
+            return "SSE2";
+        default:
+            return "scalar";
+        }
+    }
+
+    error::enmErrorType
+        runBenchmark(
+            stcBenchmarkType const& stcBenchmark,
+            float64_t const f64MinTimeSec
+        ) {
+        using objClockType = std::chrono::steady_clock;
+
+        error::enmErrorType enmErrRet = error::enmErrorNone;
+        uint64_t u64NumIters = 0;
+        float64_t f64ElapsedSec = 0.0;
+
+        // Warm up (page cache, allocations reused from here on)
+        enmErrRet = stcBenchmark.fcnRun();
+
+        objClockType::time_point const objTpBegin = objClockType::now();
+        while ((error::enmErrorNone == enmErrRet) && ((0 == u64NumIters) || (f64MinTimeSec > f64ElapsedSec))) {
+            enmErrRet = stcBenchmark.fcnRun();
+            ++u64NumIters;
+            f64ElapsedSec = std::chrono::duration<float64_t>(objClockType::now() - objTpBegin).count();
+        }
+
+        std::cout << std::left << std::setw(56) << stcBenchmark.strName << std::right;
+        if (error::enmErrorNone != enmErrRet) {
+            std::cout << "FAILED" << std::endl;
+            error::printCodeIfError(enmErrRet);
+            return enmErrRet;
+        }
+
+        float64_t const f64SecPerIter = (f64ElapsedSec / static_cast<float64_t>(u64NumIters));
+        std::cout << std::fixed << std::setprecision(3)
+            << std::setw(14) << (f64SecPerIter * 1e3)
+            << std::setw(12) << u64NumIters
+            << std::setw(12) << ((static_cast<float64_t>(stcBenchmark.u64BytesPerIter) / f64SecPerIter) / 1e6)
+            << std::setprecision(0)
+            << std::setw(16) << (static_cast<float64_t>(stcBenchmark.u64ItemsPerIter) / f64SecPerIter)
+            << std::setprecision(1)
+            << std::setw(14) << (static_cast<float64_t>(getPeakRssBytes()) / (1024.0 * 1024.0))
+            << std::endl;
+        return error::enmErrorNone;
+    }
+
+    void
+        addScenarioBenchmarks(
+            stcScenarioType const& stcScenario,
+            std::string const& strPrefix,
+            uint32_t const u32NumThreads,
+            comtrade::stcConfigFileType& stcCfg,
+            comtrade::stcDataFileType& stcDat,
+            std::vector<stcBenchmarkType>& vctStcBenchmarksOut
+        ) {
+        uint64_t const u64CfgBytes = static_cast<uint64_t>(std::filesystem::file_size(strPrefix + ".CFG"));
+        uint64_t const u64DatBytes = static_cast<uint64_t>(std::filesystem::file_size(strPrefix + ".DAT"));
+        uint64_t const u64TotalSamples = stcScenario.stcRecord.vctSamplingRateInfo.back().u64LastSampleNumber;
+        bool const bBinary = (comtrade::enmDataFileFormatAscii != stcScenario.stcRecord.enmDataFileFormat);
+
+        /* Configuration file */
+        vctStcBenchmarksOut.push_back(stcBenchmarkType{
+            ("parseConfigFile/" + stcScenario.strName),
+            u64CfgBytes,
+            1,
+            [strPrefix, &stcCfg]() {
+                return comtrade::parseConfigFile(strPrefix, stcCfg);
+            }
+            });
+
+        /* Data file (the record is reused, as a long-running ingestion loop would) */
+        std::vector<uint32_t> vctU32Threads{ 1 };
+        if (bBinary && (1 != u32NumThreads)) {
+            vctU32Threads.push_back(u32NumThreads);
+        }
+        for (uint32_t const u32Threads : vctU32Threads) {
+            comtrade::stcParseOptionsType stcOpts{};
+            stcOpts.u32NumThreads = u32Threads;
+            vctStcBenchmarksOut.push_back(stcBenchmarkType{
+                ("parseDataFile/" + stcScenario.strName + "/threads:" + std::to_string(u32Threads)),
+                u64DatBytes,
+                u64TotalSamples,
+                [stcOpts, &stcCfg, &stcDat]() {
+                    return comtrade::parseDataFile(stcCfg, stcDat, stcOpts);
+                }
+                });
+        }
+        if (bBinary) {
+            comtrade::stcParseOptionsType stcOpts{};
+            stcOpts.bLazy = true;
+            vctStcBenchmarksOut.push_back(stcBenchmarkType{
+                ("parseDataFile/" + stcScenario.strName + "/lazy"),
+                u64DatBytes,
+                u64TotalSamples,
+                [stcOpts, &stcCfg, &stcDat]() {
+                    return comtrade::parseDataFile(stcCfg, stcDat, stcOpts);
+                }
+                });
+        }
+
+        vctStcBenchmarksOut.push_back(stcBenchmarkType{
+            ("clsSampleCursor/" + stcScenario.strName + "/block:65536"),
+            u64DatBytes,
+            u64TotalSamples,
+            [&stcCfg, ptrStcBlock = std::make_shared<comtrade::stcDataFileType>()]() {
+                // One block record reused for the whole file (the full parse above is kept for lookups)
+                comtrade::clsSampleCursor objCursor;
+                error::enmErrorType enmErr = objCursor.open(stcCfg);
+                while ((error::enmErrorNone == enmErr) && (!objCursor.isDone())) {
+                    enmErr = objCursor.next(*ptrStcBlock);
+                }
+                return enmErr;
+            }
+            });
+
+        /* Lookups (over the last full parse) */
+        vctStcBenchmarksOut.push_back(stcBenchmarkType{
+            ("getAnalogChannel/" + stcScenario.strName),
+            0,
+            stcScenario.stcRecord.u32NumAnaChannels,
+            [&stcCfg, &stcDat]() {
+                float64_t f64Sum = 0.0;
+                for (size_t sizIter = 0; stcCfg.objVmAnalogChannelInfo.size() > sizIter; ++sizIter) {
+                    comtrade::stcAnalogChannelViewType stcAnaChanView{};
+                    error::enmErrorType const enmErr = comtrade::getAnalogChannel(
+                        stcCfg,
+                        stcDat,
+                        stcCfg.objVmAnalogChannelInfo.key(sizIter),
+                        stcAnaChanView
+                    );
+                    if (error::enmErrorNone != enmErr) {
+                        return enmErr;
+                    }
+                    f64Sum += stcAnaChanView[0].f64Data;
+                }
+                f64Sink = f64Sum;
+                return error::enmErrorNone;
+            }
+            });
+        std::vector<uint32_t> vctU32StatsThreads{ 1 };
+        if (1 != u32NumThreads) {
+            vctU32StatsThreads.push_back(u32NumThreads);
+        }
+        for (uint32_t const u32Threads : vctU32StatsThreads) {
+            stats::stcStatsOptionsType stcStatsOpts{};
+            stcStatsOpts.u32NumThreads = u32Threads;
+            vctStcBenchmarksOut.push_back(stcBenchmarkType{
+                ("computeChannelStats/" + stcScenario.strName + "/threads:" + std::to_string(u32Threads)),
+                0,
+                (u64TotalSamples * stcScenario.stcRecord.u32NumAnaChannels),
+                [stcStatsOpts, &stcCfg, &stcDat, ptrVctStcStats = std::make_shared<std::vector<stats::stcChannelStatsType>>()]() {
+                    return stats::computeChannelStats(stcCfg, stcDat, *ptrVctStcStats, stcStatsOpts);
+                }
+                });
+        }
+        vctStcBenchmarksOut.push_back(stcBenchmarkType{
+            ("getAnalogSampleView/" + stcScenario.strName),
+            0,
+            u64TotalSamples,
+            [&stcDat]() {
+                float64_t f64Sum = 0.0;
+                for (comtrade::stcSampleDataType const& stcSampleData : stcDat.vctSampleData) {
+                    comtrade::stcAnalogSampleViewType const stcAnaSampleView = comtrade::getAnalogSampleView(stcDat, stcSampleData);
+                    for (size_t sizIter = 0; stcAnaSampleView.size() > sizIter; ++sizIter) {
+                        f64Sum += stcAnaSampleView[sizIter].f64Data;
+                    }
+                }
+                f64Sink = f64Sum;
+                return error::enmErrorNone;
+            }
+            });
+        vctStcBenchmarksOut.push_back(stcBenchmarkType{
+            ("getSampleIndexAtTime/" + stcScenario.strName),
+            0,
+            4096,
+            [&stcCfg]() {
+                float64_t f64EndUs = 0.0;
+                error::enmErrorType enmErr = comtrade::getSampleTimeUs(stcCfg, (stcCfg.u64TotalSamples - 1), f64EndUs);
+                uint64_t u64Sum = 0;
+                for (size_t sizIter = 0; (error::enmErrorNone == enmErr) && (4096 > sizIter); ++sizIter) {
+                    uint64_t u64SampleIdx = 0;
+                    enmErr = comtrade::getSampleIndexAtTime(stcCfg, ((f64EndUs * static_cast<float64_t>(sizIter)) / 4096.0), u64SampleIdx);
+                    u64Sum += u64SampleIdx;
+                }
+                f64Sink = static_cast<float64_t>(u64Sum);
+                return enmErr;
+            }
+            });
+    }
+
+    bool
+        parseArgs(
+            int const intArgc,
+            char** const ptrPtrChrArgv,
+            stcBenchOptionsType& stcOptsOut,
+            std::vector<stcScenarioType>& vctStcScenariosOut
+        ) {
+        stcScenarioType stcCustom{ "custom", {} };
+        bool bCustom = false;
+
+        for (int intIter = 1; intArgc > intIter; ++intIter) {
+            std::string_view const objSvArg(ptrPtrChrArgv[intIter]);
+            if ("--keep" == objSvArg) {
+                stcOptsOut.bKeep = true;
+                continue;
+            }
+            if ((intIter + 1) >= intArgc) {
+                return false;
+            }
+            std::string_view const objSvValue(ptrPtrChrArgv[++intIter]);
+
+            error::enmErrorType enmErr = error::enmErrorNone;
+            if ("--filter" == objSvArg) {
+                stcOptsOut.strFilter.assign(objSvValue);
+            }
+            else if ("--min-time" == objSvArg) {
+                enmErr = utils::parseNumber(objSvValue, stcOptsOut.f64MinTimeSec);
+            }
+            else if ("--threads" == objSvArg) {
+                enmErr = utils::parseNumber(objSvValue, stcOptsOut.u32NumThreads);
+            }
+            else if ("--dir" == objSvArg) {
+                stcOptsOut.strDir.assign(objSvValue);
+            }
+            else if ("--format" == objSvArg) {
+                bCustom = true;
+                if ("ascii" == objSvValue) {
+                    stcCustom.stcRecord.enmDataFileFormat = comtrade::enmDataFileFormatAscii;
+                }
+                else if ("binary" == objSvValue) {
+                    stcCustom.stcRecord.enmDataFileFormat = comtrade::enmDataFileFormatBinary;
+                }
+                else if ("binary32" == objSvValue) {
+                    stcCustom.stcRecord.enmDataFileFormat = comtrade::enmDataFileFormatBinary32;
+                }
+                else if ("float32" == objSvValue) {
+                    stcCustom.stcRecord.enmDataFileFormat = comtrade::enmDataFileFormatFloat32;
+                }
+                else {
+                    enmErr = error::enmErrorInvalidArg;
+                }
+            }
+            else if ("--ana" == objSvArg) {
+                bCustom = true;
+                enmErr = utils::parseNumber(objSvValue, stcCustom.stcRecord.u32NumAnaChannels);
+            }
+            else if ("--dig" == objSvArg) {
+                bCustom = true;
+                enmErr = utils::parseNumber(objSvValue, stcCustom.stcRecord.u32NumDigChannels);
+            }
+            else if ("--samples" == objSvArg) {
+                bCustom = true;
+                enmErr = utils::parseNumber(objSvValue, stcCustom.stcRecord.vctSamplingRateInfo.front().u64LastSampleNumber);
+            }
+            else if ("--rate" == objSvArg) {
+                bCustom = true;
+                enmErr = utils::parseNumber(objSvValue, stcCustom.stcRecord.vctSamplingRateInfo.front().f64SamplesPerSec);
+            }
+            else if ("--seed" == objSvArg) {
+                bCustom = true;
+                enmErr = utils::parseNumber(objSvValue, stcCustom.stcRecord.u32Seed);
+            }
+            else {
+                enmErr = error::enmErrorInvalidArg;
+            }
+            if (error::enmErrorNone != enmErr) {
+                return false;
+            }
+        }
+
+        if (bCustom) {
+            vctStcScenariosOut.push_back(stcCustom);
+            return true;
+        }
+
+        /* Built-in scenarios (a typical relay record in both formats, and a wide multi-rate one) */
+        stcScenarioType stcScenario{};
+        stcScenario.strName = "binary_16a_32d";
+        stcScenario.stcRecord.u32NumAnaChannels = 16;
+        stcScenario.stcRecord.u32NumDigChannels = 32;
+        stcScenario.stcRecord.vctSamplingRateInfo = { { 4800.0, 200000 } };
+        vctStcScenariosOut.push_back(stcScenario);
+
+        stcScenario.strName = "ascii_16a_32d";
+        stcScenario.stcRecord.vctSamplingRateInfo = { { 4800.0, 50000 } };
+        stcScenario.stcRecord.enmDataFileFormat = comtrade::enmDataFileFormatAscii;
+        vctStcScenariosOut.push_back(stcScenario);
+
+        stcScenario.strName = "binary_96a_256d_multirate";
+        stcScenario.stcRecord.u32NumAnaChannels = 96;
+        stcScenario.stcRecord.u32NumDigChannels = 256;
+        stcScenario.stcRecord.vctSamplingRateInfo = { { 15360.0, 60000 }, { 960.0, 90000 } };
+        stcScenario.stcRecord.enmDataFileFormat = comtrade::enmDataFileFormatBinary;
+        vctStcScenariosOut.push_back(stcScenario);
+        return true;
+    }
+
+}
+
+int
+main(
+    int argc,
+    char** argv
+) {
+    // Only failures are worth reporting while parses are being timed
+    diag::setSink(diag::writeToConsole);
+    diag::setLevel(diag::enmLevelWarning);
+
+    stcBenchOptionsType stcOpts{};
+    std::vector<stcScenarioType> vctStcScenarios;
+    if (!parseArgs(argc, argv, stcOpts, vctStcScenarios)) {
+        std::cerr << "usage: " << argv[0] << " [--filter <text>] [--min-time <seconds>] [--threads <n>]"
+            << " [--dir <path>] [--keep] [--format ascii|binary|binary32|float32] [--ana <n>] [--dig <n>]"
+            << " [--samples <n>] [--rate <Hz>] [--seed <n>]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (0 == stcOpts.u32NumThreads) {
+        stcOpts.u32NumThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::error_code objErrCode;
+    std::filesystem::path const objPathDir = stcOpts.strDir.empty()
+        ? (std::filesystem::temp_directory_path(objErrCode) / "comtrade-bench")
+        : std::filesystem::path(stcOpts.strDir);
+    std::filesystem::create_directories(objPathDir, objErrCode);
+    if (objErrCode) {
+        std::cerr << "cannot create " << objPathDir.string() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    /* Context (so results from different hosts can be compared) */
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency()
+        << ", SIMD: " << getSimdName(decode::getSimdLevel())
+#if defined(_MSC_VER)
+        << ", compiler: MSVC " << _MSC_VER
+#elif defined(__clang__)
+        << ", compiler: clang " << __clang_major__ << "." << __clang_minor__
+#elif defined(__GNUC__)
+        << ", compiler: GCC " << __GNUC__ << "." << __GNUC_MINOR__
+#endif
+#if defined(NDEBUG)
+        << ", build: release"
+#else
+        << ", build: debug (timings are not representative)"
+#endif
+        << std::endl << std::endl;
+    std::cout << std::left << std::setw(56) << "Benchmark" << std::right
+        << std::setw(14) << "Time (ms)"
+        << std::setw(12) << "Iterations"
+        << std::setw(12) << "MB/s"
+        << std::setw(16) << "items/s"
+        << std::setw(14) << "Peak RSS (MB)"
+        << std::endl;
+    std::cout << std::string(124, '-') << std::endl;
+
+    int intRet = EXIT_SUCCESS;
+    for (stcScenarioType const& stcScenario : vctStcScenarios) {
+        std::string const strPrefix = (objPathDir / stcScenario.strName).string();
+        error::enmErrorType enmErr = synth::writeSyntheticRecord(stcScenario.stcRecord, strPrefix);
+        if (error::enmErrorNone != enmErr) {
+            std::cerr << "cannot write " << strPrefix << std::endl;
+            error::printCodeIfError(enmErr);
+            return EXIT_FAILURE;
+        }
+
+        // Shared by the benchmarks of the scenario (parsed once up front for the lookups)
+        comtrade::stcConfigFileType stcCfg{};
+        comtrade::stcDataFileType stcDat{};
+        enmErr = comtrade::parseConfigFile(strPrefix, stcCfg);
+        if (error::enmErrorNone == enmErr) {
+            enmErr = comtrade::parseDataFile(stcCfg, stcDat);
+        }
+        if (error::enmErrorNone != enmErr) {
+            std::cerr << "cannot parse " << strPrefix << std::endl;
+            error::printCodeIfError(enmErr);
+            return EXIT_FAILURE;
+        }
+
+        std::vector<stcBenchmarkType> vctStcBenchmarks;
+        addScenarioBenchmarks(stcScenario, strPrefix, stcOpts.u32NumThreads, stcCfg, stcDat, vctStcBenchmarks);
+
+        for (stcBenchmarkType const& stcBenchmark : vctStcBenchmarks) {
+            if (std::string::npos == stcBenchmark.strName.find(stcOpts.strFilter)) {
+                continue;
+            }
+            // Lookups (no input bytes) need every channel decoded, so undo a preceding lazy parse
+            bool const bLookup = (0 == stcBenchmark.u64BytesPerIter);
+            if (bLookup && stcDat.bLazy) {
+                comtrade::parseDataFile(stcCfg, stcDat);
+            }
+            if (error::enmErrorNone != runBenchmark(stcBenchmark, stcOpts.f64MinTimeSec)) {
+                intRet = EXIT_FAILURE;
+            }
+        }
+
+        if (!stcOpts.bKeep) {
+            std::filesystem::remove(strPrefix + ".CFG", objErrCode);
+            std::filesystem::remove(strPrefix + ".DAT", objErrCode);
+        }
+    }
+
+    return intRet;
+}
@@ -0,0 +1,373 @@
+/**
+ * @file catalog.cpp
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#include "catalog.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+#include "threadPool.h"
+
+namespace catalog {
+
+    namespace {
+
+        // Private variables
+
+        // 5.3.7 --> ft (as written in the configuration file)
+        char const* const arrPtrChrFormatNames[comtrade::enmDataFileFormatTypeCount] = {
+            "ASCII",
+            "BINARY",
+            "BINARY32",
+            "FLOAT32"
+        };
+
+        // Private functions
+
+        bool
+            isConfigFileName(
+                std::filesystem::path const& objPath
+            ) {
+            std::string const strExt = objPath.extension().string();
+            return (
+                (4 == strExt.size())
+                && ('.' == strExt[0])
+                && ('c' == std::tolower(static_cast<unsigned char>(strExt[1])))
+                && ('f' == std::tolower(static_cast<unsigned char>(strExt[2])))
+                && ('g' == std::tolower(static_cast<unsigned char>(strExt[3])))
+                );
+        }
+
+        void
+            scanRecord(
+                std::filesystem::path const& objPathCfg,
+                stcCatalogEntryType& stcEntryOut
+            ) {
+            // One configuration per worker thread, reused so its strings and vectors keep their
+            // capacity from one record to the next
+            thread_local comtrade::stcConfigFileType stcCfg{};
+
+            // Data file sits next to the configuration file, with a matching extension case
+            std::filesystem::path objPathDat = objPathCfg;
+            bool const bLowerExt = std::islower(static_cast<unsigned char>(objPathCfg.extension().string()[1]));
+            objPathDat.replace_extension(bLowerExt ? ".dat" : ".DAT");
+            stcEntryOut.strCfgFileName = objPathCfg.string();
+            stcEntryOut.strDatFileName = objPathDat.string();
+
+            // Size the data file without opening it
+            std::error_code objEc;
+            std::uintmax_t const objDatSize = std::filesystem::file_size(objPathDat, objEc);
+            stcEntryOut.bDatExists = !objEc;
+            stcEntryOut.u64DatSizeBytes = objEc ? 0 : static_cast<uint64_t>(objDatSize);
+            stcEntryOut.u64ExpectedDatSizeBytes = 0;
+
+            stcEntryOut.enmErr = comtrade::parseConfigHeader(stcEntryOut.strCfgFileName, stcCfg);
+            if (error::enmErrorNone != stcEntryOut.enmErr) {
+                return;
+            }
+
+            stcEntryOut.strStationName = stcCfg.strStationName;
+            stcEntryOut.strDeviceId = stcCfg.strDeviceId;
+            stcEntryOut.u16Version = stcCfg.u16Version;
+            stcEntryOut.u32NumAnaChannels = stcCfg.u32NumAnaChannels;
+            stcEntryOut.u32NumDigChannels = stcCfg.u32NumDigChannels;
+            stcEntryOut.vctSamplingRateInfo = stcCfg.vctSamplingRateInfo;
+            stcEntryOut.u64TotalSamples = stcCfg.u64TotalSamples;
+            stcEntryOut.stcDateTimeStart = stcCfg.stcDateTimeStart;
+            stcEntryOut.stcDateTimeTrigger = stcCfg.stcDateTimeTrigger;
+            stcEntryOut.enmDataFileFormat = stcCfg.enmDataFileFormat;
+            stcEntryOut.f64TimeMult = stcCfg.f64TimeMult;
+
+            if (comtrade::enmDataFileFormatAscii != stcCfg.enmDataFileFormat) {
+                stcEntryOut.u64ExpectedDatSizeBytes = (
+                    stcCfg.u64TotalSamples
+                    * static_cast<uint64_t>(comtrade::getBinarySampleSizeBytes(stcCfg))
+                    );
+            }
+        }
+
+        void
+            appendCsvString(
+                std::string const& strIn,
+                std::string& strOut
+            ) {
+            // Always quoted (file paths may contain commas), embedded quotes doubled
+            strOut += '"';
+            for (char const chrIter : strIn) {
+                if ('"' == chrIter) {
+                    strOut += '"';
+                }
+                strOut += chrIter;
+            }
+            strOut += '"';
+        }
+
+        void
+            appendCsvDateTime(
+                comtrade::stcDateTimeType const& stcDateTime,
+                std::string& strOut
+            ) {
+            char arrChrBuf[64] = {};
+            int const iNumChars = std::snprintf(
+                arrChrBuf,
+                sizeof(arrChrBuf),
+                "%02u/%02u/%04u %02u:%02u:%09.6f",
+                static_cast<unsigned int>(stcDateTime.stcDate.u8Day),
+                static_cast<unsigned int>(stcDateTime.stcDate.u8Month),
+                static_cast<unsigned int>(stcDateTime.stcDate.u16Year),
+                static_cast<unsigned int>(stcDateTime.stcTime.u8Hour),
+                static_cast<unsigned int>(stcDateTime.stcTime.u8Minute),
+                stcDateTime.stcTime.f64Second
+            );
+            strOut.append(arrChrBuf, static_cast<size_t>(std::max(0, iNumChars)));
+        }
+
+        template <typename typUintType>
+        void
+            appendLe(
+                typUintType const typValue,
+                std::string& strOut
+            ) {
+            for (size_t sizIter = 0; sizeof(typUintType) > sizIter; ++sizIter) {
+                strOut += static_cast<char>((typValue >> (8 * sizIter)) & 0xFF);
+            }
+        }
+
+        void
+            appendLe(
+                float64_t const f64Value,
+                std::string& strOut
+            ) {
+            uint64_t u64Bits = 0;
+            static_assert(sizeof(u64Bits) == sizeof(f64Value), "float64_t must be 8 bytes");
+            std::memcpy(&u64Bits, &f64Value, sizeof(u64Bits));
+            appendLe(u64Bits, strOut);
+        }
+
+        void
+            appendLe(
+                std::string const& strValue,
+                std::string& strOut
+            ) {
+            appendLe(static_cast<uint32_t>(strValue.size()), strOut);
+            strOut += strValue;
+        }
+
+        void
+            appendLe(
+                comtrade::stcDateTimeType const& stcDateTime,
+                std::string& strOut
+            ) {
+            appendLe(stcDateTime.stcDate.u16Year, strOut);
+            appendLe(stcDateTime.stcDate.u8Month, strOut);
+            appendLe(stcDateTime.stcDate.u8Day, strOut);
+            appendLe(stcDateTime.stcTime.u8Hour, strOut);
+            appendLe(stcDateTime.stcTime.u8Minute, strOut);
+            appendLe(stcDateTime.stcTime.f64Second, strOut);
+        }
+
+        void
+            formatCsv(
+                std::vector<stcCatalogEntryType> const& vctStcEntries,
+                std::string& strOut
+            ) {
+            strOut += "cfg_file,dat_file,error,station_name,rec_dev_id,rev_year,analog_channels,"
+                "digital_channels,sampling_rates,total_samples,start,trigger,format,timemult,"
+                "dat_exists,dat_bytes,expected_dat_bytes,dat_size_ok\n";
+
+            for (stcCatalogEntryType const& stcEntry : vctStcEntries) {
+                appendCsvString(stcEntry.strCfgFileName, strOut);
+                strOut += ',';
+                appendCsvString(stcEntry.strDatFileName, strOut);
+                strOut += ',';
+                strOut += std::to_string(static_cast<int>(stcEntry.enmErr));
+                strOut += ',';
+
+                if (error::enmErrorNone == stcEntry.enmErr) {
+                    appendCsvString(stcEntry.strStationName, strOut);
+                    strOut += ',';
+                    appendCsvString(stcEntry.strDeviceId, strOut);
+                    strOut += ',';
+                    strOut += std::to_string(stcEntry.u16Version);
+                    strOut += ',';
+                    strOut += std::to_string(stcEntry.u32NumAnaChannels);
+                    strOut += ',';
+                    strOut += std::to_string(stcEntry.u32NumDigChannels);
+                    strOut += ',';
+
+                    // samp/endsamp pairs, separated by semicolons
+                    for (size_t sizIter = 0; stcEntry.vctSamplingRateInfo.size() > sizIter; ++sizIter) {
+                        if (0 != sizIter) {
+                            strOut += ';';
+                        }
+                        char arrChrBuf[64] = {};
+                        int const iNumChars = std::snprintf(
+                            arrChrBuf,
+                            sizeof(arrChrBuf),
+                            "%.17g/%llu",
+                            stcEntry.vctSamplingRateInfo[sizIter].f64SamplesPerSec,
+                            static_cast<unsigned long long>(stcEntry.vctSamplingRateInfo[sizIter].u64LastSampleNumber)
+                        );
+                        strOut.append(arrChrBuf, static_cast<size_t>(std::max(0, iNumChars)));
+                    }
+                    strOut += ',';
+                    strOut += std::to_string(stcEntry.u64TotalSamples);
+                    strOut += ',';
+                    appendCsvDateTime(stcEntry.stcDateTimeStart, strOut);
+                    strOut += ',';
+                    appendCsvDateTime(stcEntry.stcDateTimeTrigger, strOut);
+                    strOut += ',';
+                    strOut += arrPtrChrFormatNames[stcEntry.enmDataFileFormat];
+                    strOut += ',';
+                    char arrChrBuf[32] = {};
+                    int const iNumChars = std::snprintf(arrChrBuf, sizeof(arrChrBuf), "%.17g", stcEntry.f64TimeMult);
+                    strOut.append(arrChrBuf, static_cast<size_t>(std::max(0, iNumChars)));
+                    strOut += ',';
+                }
+                else {
+                    // Header fields unknown
+                    strOut += ",,,,,,,,,,,";
+                }
+
+                strOut += (stcEntry.bDatExists ? '1' : '0');
+                strOut += ',';
+                strOut += std::to_string(stcEntry.u64DatSizeBytes);
+                strOut += ',';
+                strOut += std::to_string(stcEntry.u64ExpectedDatSizeBytes);
+                strOut += ',';
+                // same acceptance as `parseDataFile` (binary data files may carry trailing bytes)
+                bool const bDatSizeOk = (
+                    (error::enmErrorNone == stcEntry.enmErr)
+                    && stcEntry.bDatExists
+                    && (stcEntry.u64DatSizeBytes >= stcEntry.u64ExpectedDatSizeBytes)
+                    );
+                strOut += (bDatSizeOk ? '1' : '0');
+                strOut += '\n';
+            }
+        }
+
+        void
+            formatBinary(
+                std::vector<stcCatalogEntryType> const& vctStcEntries,
+                std::string& strOut
+            ) {
+            strOut.append("CTCAT\0", 6);
+            appendLe(static_cast<uint16_t>(1), strOut);
+            appendLe(static_cast<uint64_t>(vctStcEntries.size()), strOut);
+
+            for (stcCatalogEntryType const& stcEntry : vctStcEntries) {
+                appendLe(static_cast<uint8_t>(stcEntry.enmErr), strOut);
+                appendLe(stcEntry.strCfgFileName, strOut);
+                appendLe(stcEntry.strDatFileName, strOut);
+                appendLe(stcEntry.strStationName, strOut);
+                appendLe(stcEntry.strDeviceId, strOut);
+                appendLe(stcEntry.u16Version, strOut);
+                appendLe(stcEntry.u32NumAnaChannels, strOut);
+                appendLe(stcEntry.u32NumDigChannels, strOut);
+                appendLe(static_cast<uint32_t>(stcEntry.vctSamplingRateInfo.size()), strOut);
+                for (comtrade::stcSamplingRateInfoType const& stcRateInfo : stcEntry.vctSamplingRateInfo) {
+                    appendLe(stcRateInfo.f64SamplesPerSec, strOut);
+                    appendLe(stcRateInfo.u64LastSampleNumber, strOut);
+                }
+                appendLe(stcEntry.u64TotalSamples, strOut);
+                appendLe(stcEntry.stcDateTimeStart, strOut);
+                appendLe(stcEntry.stcDateTimeTrigger, strOut);
+                appendLe(static_cast<uint8_t>(stcEntry.enmDataFileFormat), strOut);
+                appendLe(stcEntry.f64TimeMult, strOut);
+                appendLe(static_cast<uint8_t>(stcEntry.bDatExists ? 1 : 0), strOut);
+                appendLe(stcEntry.u64DatSizeBytes, strOut);
+                appendLe(stcEntry.u64ExpectedDatSizeBytes, strOut);
+            }
+        }
+
+    }
+
+    error::enmErrorType
+        scanDirectory(
+            std::string const& strRootDir,
+            stcScanOptionsType const& stcOpts,
+            std::vector<stcCatalogEntryType>& vctStcEntriesOut
+        ) {
+        vctStcEntriesOut.clear();
+
+        std::error_code objEc;
+        if (!std::filesystem::is_directory(strRootDir, objEc)) {
+            return error::enmErrorFileDne;
+        }
+
+        /* Collect configuration files */
+        std::vector<std::filesystem::path> vctObjPathCfg;
+        std::filesystem::recursive_directory_iterator objRdi(
+            strRootDir,
+            std::filesystem::directory_options::skip_permission_denied,
+            objEc
+        );
+        for (; (!objEc) && (std::filesystem::recursive_directory_iterator{} != objRdi); objRdi.increment(objEc)) {
+            std::error_code objEcEntry;
+            if (objRdi->is_regular_file(objEcEntry) && isConfigFileName(objRdi->path())) {
+                vctObjPathCfg.push_back(objRdi->path());
+            }
+        }
+        if (objEc) {
+            // Walk was cut short (e.g., a directory vanished mid-scan)
+            return error::enmErrorFileDne;
+        }
+        std::sort(vctObjPathCfg.begin(), vctObjPathCfg.end());
+
+        /* Catalog records in parallel (each task writes only its own entry) */
+        size_t const sizNumThreads = tp::resolveNumThreads(stcOpts.u32NumThreads);
+        vctStcEntriesOut.resize(vctObjPathCfg.size());
+        tp::clsThreadPool::getShared().parallelFor(
+            vctObjPathCfg.size(),
+            sizNumThreads,
+            [&vctObjPathCfg, &vctStcEntriesOut](size_t const sizIdx) {
+                scanRecord(vctObjPathCfg[sizIdx], vctStcEntriesOut[sizIdx]);
+            }
+        );
+
+        return error::enmErrorNone;
+    }
+
+    error::enmErrorType
+        writeCatalog(
+            std::vector<stcCatalogEntryType> const& vctStcEntries,
+            enmCatalogFormatType const enmFormat,
+            std::string const& strFileName
+        ) {
+        std::string strOut;
+        switch (enmFormat) {
+        case enmCatalogFormatCsv: {
+            formatCsv(vctStcEntries, strOut);
+            break;
+        }
+        case enmCatalogFormatBinary: {
+            formatBinary(vctStcEntries, strOut);
+            break;
+        }
+        default: {
+            return error::enmErrorInvalidArg;
+        }
+        }
+
+        std::ofstream objOfsCatalog(strFileName, (std::ofstream::binary | std::ofstream::out | std::ofstream::trunc));
+        if (!objOfsCatalog.is_open()) {
+            return error::enmErrorFileDne;
+        }
+        objOfsCatalog.write(strOut.data(), static_cast<std::streamsize>(strOut.size()));
+        if (!objOfsCatalog) {
+            return error::enmErrorFileDne;
+        }
+
+        return error::enmErrorNone;
+    }
+
+}
@@ -0,0 +1,97 @@
+/**
+ * @file catalog.h
+ * @brief Bulk indexing of COMTRADE records from their configuration file headers.
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "comtrade.h"
+#include "error.h"
+#include "types.h"
+
+namespace catalog {
+
+    enum enmCatalogFormatType {
+        enmCatalogFormatCsv,
+        enmCatalogFormatBinary,
+
+        enmCatalogFormatTypeCount
+    };
+
+    // One record of the catalog (configuration header fields plus data file size check)
+    struct stcCatalogEntryType {
+        // result of parsing the configuration header (other fields are only valid on success)
+        error::enmErrorType enmErr;
+
+        std::string strCfgFileName;
+        std::string strDatFileName;
+
+        // 5.3.1 --> station_name, rec_dev_id, rev_year
+        std::string strStationName;
+        std::string strDeviceId;
+        uint16_t u16Version;
+
+        // 5.3.2 --> ##A, ##D
+        uint32_t u32NumAnaChannels;
+        uint32_t u32NumDigChannels;
+
+        // 5.3.5 --> samp, endsamp (per sampling rate)
+        std::vector<comtrade::stcSamplingRateInfoType> vctSamplingRateInfo;
+        uint64_t u64TotalSamples;
+
+        // 5.3.6 --> start and trigger time
+        comtrade::stcDateTimeType stcDateTimeStart;
+        comtrade::stcDateTimeType stcDateTimeTrigger;
+
+        // 5.3.7 / 5.3.8 --> ft, timemult
+        comtrade::enmDataFileFormatType enmDataFileFormat;
+        float64_t f64TimeMult;
+
+        // data file size on disk (0 if missing) and as implied by the configuration (binary
+        // only, 0 for ASCII since its size depends on the text)
+        bool bDatExists;
+        uint64_t u64DatSizeBytes;
+        uint64_t u64ExpectedDatSizeBytes;
+    };
+
+    struct stcScanOptionsType {
+        // Worker threads (0 --> one per hardware thread, 1 --> serial)
+        uint32_t u32NumThreads = 0;
+    };
+
+    // Walk a directory tree and catalog every record (`.cfg` file, any case) found in it
+    //
+    // Only the configuration header of each record is parsed and its data file is only sized,
+    // never opened. Entries are sorted by configuration file name; a record that fails to parse
+    // still gets an entry carrying its error.
+    error::enmErrorType
+        scanDirectory(
+            std::string const& strRootDir,
+            stcScanOptionsType const& stcOpts,
+            std::vector<stcCatalogEntryType>& vctStcEntriesOut
+        );
+
+    // Write a catalog as CSV (one header row, then one row per record) or as a compact
+    // little-endian binary file
+    //
+    // Binary layout: "CTCAT\0" magic, u16 version (1), u64 entry count, then per entry
+    //     u8 error, str cfg, str dat, str station, str device, u16 rev_year, u32 ##A, u32 ##D,
+    //     u32 rate count, (f64 samp, u64 endsamp) per rate, u64 total samples,
+    //     start and trigger as (u16 year, u8 month, u8 day, u8 hour, u8 minute, f64 second),
+    //     u8 format (0 ASCII, 1 BINARY, 2 BINARY32, 3 FLOAT32), f64 timemult, u8 data file exists, u64 data file size,
+    //     u64 expected data file size
+    // where `str` is a u32 byte count followed by the (unterminated) bytes.
+    error::enmErrorType
+        writeCatalog(
+            std::vector<stcCatalogEntryType> const& vctStcEntries,
+            enmCatalogFormatType const enmFormat,
+            std::string const& strFileName
+        );
+
+}
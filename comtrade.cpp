@@ -7,12 +7,24 @@
 
 #include "comtrade.h"
 
+#include <algorithm>
+#include <bitset>
+#include <chrono>
 #include <cmath>
+#include <cstring>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <map>
+#include <mutex>
+#include <string_view>
+#include <utility>
 
+#include "decode.h"
+#include "diag.h"
+#include "threadPool.h"
 #include "utils.h"
 
 namespace comtrade {
@@ -26,7 +38,8 @@ namespace comtrade {
             "A"
         };
 
-        std::map<std::string, float64_t> const mapUnitToConversion = {
+        // transparent comparator --> lookup by `std::string_view` without a temporary string
+        std::map<std::string, float64_t, std::less<>> const mapUnitToConversion = {
             {"Y", 1.0e+24},
             {"Z", 1.0e+21},
 
@@ -57,357 +70,728 @@ namespace comtrade {
             {"z", 1.0e-21},
             {"y", 1.0e-24}
         };
-    }
 
-    error::enmErrorType
-        parseConfigFile(
-            std::string const& strFileNamePrefix,
-            stcConfigFileType& stcCfgOut
-        ) {
-        if (strFileNamePrefix.empty()) {
-            return error::enmErrorInvalidArg;
+        // Private functions
+
+        error::enmErrorType
+            getUnitConversion(
+                std::string_view const objSvUnit,
+                float64_t& f64ConvOut
+            ) {
+            if (objSvUnit.empty()) {
+                return error::enmErrorInvalidArg;
+            }
+
+            // Validate engineering unit
+            auto const objFindResult = std::find(
+                vctStrValidEngrUnits.begin(),
+                vctStrValidEngrUnits.end(),
+                objSvUnit.substr(objSvUnit.size() - 1)
+            );
+            if (vctStrValidEngrUnits.end() == objFindResult) {
+                // Invalid base unit
+                return error::enmErrorInvalidArg;
+            }
+            std::string_view const objSvPrefix = objSvUnit.substr(0, (objSvUnit.size() - 1));
+            auto const objConvResult = mapUnitToConversion.find(objSvPrefix);
+            if (mapUnitToConversion.end() == objConvResult) {
+                // Invalid prefix
+                return error::enmErrorInvalidArg;
+            }
+
+            // Convert according to unit (e.g., A vs kA)
+            f64ConvOut = objConvResult->second;
+            return error::enmErrorNone;
         }
 
-        std::cout << "? ? ? INFO ? ? ? Parsing configuration file...";
+        template <typename typNumType>
+        error::enmErrorType
+            popNumber(
+                std::string_view& objSvLineInOut,
+                char const chrDelim,
+                typNumType& typNumOut
+            ) {
+            std::string_view objSvToken;
+            if (!utils::popToken(objSvLineInOut, chrDelim, objSvToken)) {
+                // Missing field
+                return error::enmErrorInvalidArg;
+            }
+            return utils::parseNumber(objSvToken, typNumOut);
+        }
 
-        /* Un-initialize configuration data */
-        stcCfgOut.bInit = false;
+        // Field that may be left blank (NaN if blank, missing, or malformed)
+        float64_t
+            popOptionalNumber(
+                std::string_view& objSvLineInOut,
+                char const chrDelim
+            ) {
+            std::string_view objSvToken;
+            float64_t f64Number = std::nan("");
+            if (
+                (!utils::popToken(objSvLineInOut, chrDelim, objSvToken))
+                || (error::enmErrorNone != utils::parseNumber(objSvToken, f64Number))
+                ) {
+                f64Number = std::nan("");
+            }
+            return f64Number;
+        }
 
-        /* Open configuration file */
-        std::string strCfgFileName = std::string(strFileNamePrefix);
-        strCfgFileName.append(".CFG");
-        std::ifstream objIfsCfg;
-        error::enmErrorType enmErrOpen = utils::openFile(
-            strCfgFileName,
-            std::ifstream::in,
-            objIfsCfg
-        );
-        if (error::enmErrorNone != enmErrOpen) {
-            objIfsCfg.close();
-            return enmErrOpen;
+        error::enmErrorType
+            popString(
+                std::string_view& objSvLineInOut,
+                char const chrDelim,
+                std::string& strOut
+            ) {
+            std::string_view objSvToken;
+            if (!utils::popToken(objSvLineInOut, chrDelim, objSvToken)) {
+                // Missing field
+                return error::enmErrorInvalidArg;
+            }
+            // reuses the capacity of `strOut` when re-parsing into the same structure
+            strOut.assign(objSvToken.data(), objSvToken.size());
+            return error::enmErrorNone;
         }
 
-        /* Validate data file */
-        std::string strDatFileName = std::string(strFileNamePrefix);
-        strDatFileName.append(".DAT");
-        std::ifstream objIfsDat;
-        enmErrOpen = utils::openFile(
-            strDatFileName,
-            std::ifstream::in,
-            objIfsDat
-        );
-        objIfsDat.close();
-        if (error::enmErrorNone != enmErrOpen) {
-            return enmErrOpen;
+        error::enmErrorType
+            popChannelInfo(
+                std::string_view& objSvLineInOut,
+                stcChannelInfoType& stcChanInfoOut
+            ) {
+            // 5.3.3 / 5.3.4 --> n, ch_id, ph, ccbm (common to analog and digital channels)
+            std::string_view objSvPhase;
+            error::enmErrorType enmErrRet = popNumber(objSvLineInOut, ',', stcChanInfoOut.u32Index);
+            if (error::enmErrorNone == enmErrRet) {
+                enmErrRet = popString(objSvLineInOut, ',', stcChanInfoOut.strName);
+            }
+            if (error::enmErrorNone == enmErrRet) {
+                enmErrRet = utils::popToken(objSvLineInOut, ',', objSvPhase)
+                    ? error::enmErrorNone
+                    : error::enmErrorInvalidArg;
+                stcChanInfoOut.chrPhase = objSvPhase.empty() ? ' ' : objSvPhase.front();
+            }
+            if (error::enmErrorNone == enmErrRet) {
+                enmErrRet = popString(objSvLineInOut, ',', stcChanInfoOut.strCircuitId);
+            }
+            return enmErrRet;
         }
 
-        /* Save file names */
-        stcCfgOut.strCfgFileName = strCfgFileName;
-        stcCfgOut.strDatFileName = strDatFileName;
+        error::enmErrorType
+            popDateTime(
+                std::string_view& objSvLineInOut,
+                stcDateTimeType& stcDateTimeOut
+            ) {
+            // 5.3.6 --> dd/mm/yyyy,hh:mm:ss.ssssss
+            std::string_view objSvDate;
+            std::string_view objSvTime;
+            if (
+                (!utils::popToken(objSvLineInOut, ',', objSvDate))
+                || (!utils::popToken(objSvLineInOut, ',', objSvTime))
+                ) {
+                return error::enmErrorInvalidArg;
+            }
+
+            error::enmErrorType enmErrRet = popNumber(objSvDate, '/', stcDateTimeOut.stcDate.u8Day);
+            if (error::enmErrorNone == enmErrRet) {
+                enmErrRet = popNumber(objSvDate, '/', stcDateTimeOut.stcDate.u8Month);
+            }
+            if (error::enmErrorNone == enmErrRet) {
+                enmErrRet = popNumber(objSvDate, '/', stcDateTimeOut.stcDate.u16Year);
+            }
+            if (error::enmErrorNone == enmErrRet) {
+                enmErrRet = popNumber(objSvTime, ':', stcDateTimeOut.stcTime.u8Hour);
+            }
+            if (error::enmErrorNone == enmErrRet) {
+                enmErrRet = popNumber(objSvTime, ':', stcDateTimeOut.stcTime.u8Minute);
+            }
+            if (error::enmErrorNone == enmErrRet) {
+                enmErrRet = popNumber(objSvTime, ':', stcDateTimeOut.stcTime.f64Second);
+            }
+            return enmErrRet;
+        }
+
+        size_t
+            countTrailingZeros(
+                uint64_t const u64Bits
+            ) {
+#if defined(__GNUC__)
+            return static_cast<size_t>(__builtin_ctzll(u64Bits));
+#else
+            size_t sizCount = 0;
+            uint64_t u64Shifted = u64Bits;
+            while ((0 != u64Shifted) && (0 == (u64Shifted & 1))) {
+                u64Shifted >>= 1;
+                ++sizCount;
+            }
+            return sizCount;
+#endif
+        }
+
+        // Mask of the bits of bitset word `sizWordIdx` that hold one of the first `sizNumSamples`
+        uint64_t
+            getValidBitMask(
+                size_t const sizNumSamples,
+                size_t const sizWordIdx
+            ) {
+            size_t const sizWordEnd = (64 * (sizWordIdx + 1));
+            if (sizNumSamples >= sizWordEnd) {
+                return ~static_cast<uint64_t>(0);
+            }
+            return ((static_cast<uint64_t>(1) << (sizNumSamples % 64)) - 1);
+        }
+
+        int64_t
+            getDaysFromCivil(
+                int64_t const i64Year,
+                int64_t const i64Month,
+                int64_t const i64Day
+            ) {
+            // Days since 1970-01-01 in the proleptic Gregorian calendar
+            int64_t const i64AdjYear = ((2 >= i64Month) ? (i64Year - 1) : i64Year);
+            int64_t const i64Era = (((0 <= i64AdjYear) ? i64AdjYear : (i64AdjYear - 399)) / 400);
+            int64_t const i64YearOfEra = (i64AdjYear - (i64Era * 400));
+            int64_t const i64DayOfYear = ((((153 * (i64Month + ((2 < i64Month) ? -3 : 9))) + 2) / 5) + i64Day - 1);
+            int64_t const i64DayOfEra = ((i64YearOfEra * 365) + (i64YearOfEra / 4) - (i64YearOfEra / 100) + i64DayOfYear);
+            return ((i64Era * 146097) + i64DayOfEra - 719468);
+        }
+
+        // Time from the first sample to the trigger (microseconds)
+        float64_t
+            getTriggerOffsetUs(
+                stcConfigFileType const& stcCfg
+            ) {
+            stcDateTimeType const& stcStart = stcCfg.stcDateTimeStart;
+            stcDateTimeType const& stcTrigger = stcCfg.stcDateTimeTrigger;
+            int64_t const i64Days = (
+                getDaysFromCivil(stcTrigger.stcDate.u16Year, stcTrigger.stcDate.u8Month, stcTrigger.stcDate.u8Day)
+                - getDaysFromCivil(stcStart.stcDate.u16Year, stcStart.stcDate.u8Month, stcStart.stcDate.u8Day)
+                );
+            int64_t const i64Minutes = (
+                (((i64Days * 24) + stcTrigger.stcTime.u8Hour) * 60) + stcTrigger.stcTime.u8Minute
+                - ((static_cast<int64_t>(stcStart.stcTime.u8Hour) * 60) + stcStart.stcTime.u8Minute)
+                );
+            float64_t const f64Seconds = (
+                (60.0 * static_cast<float64_t>(i64Minutes))
+                + (stcTrigger.stcTime.f64Second - stcStart.stcTime.f64Second)
+                );
+            return (1.0e+06 * f64Seconds);
+        }
+
+        // Index of the first sample at or after the trigger
+        uint64_t
+            getTriggerSampleIndex(
+                stcConfigFileType const& stcCfg,
+                stcDataFileType const& stcDat
+            ) {
+            float64_t const f64TriggerUs = getTriggerOffsetUs(stcCfg);
+            if (0.0 >= f64TriggerUs) {
+                return 0;
+            }
+
+            uint64_t u64SampleIdx = 0;
+            if (stcCfg.bFixedRate && (error::enmErrorNone == getSampleIndexAtTime(stcCfg, f64TriggerUs, u64SampleIdx))) {
+                // Fixed rate --> sample time is implied by sample index (relative to a slice)
+                u64SampleIdx -= std::min(u64SampleIdx, stcDat.u64FirstSampleIdx);
+                return std::min(stcDat.u64TotalSamples, u64SampleIdx);
+            }
+
+            // No fixed rate --> use the recorded timestamps, passing over samples without one (NaN)
+            auto const objFindResult = std::lower_bound(
+                stcDat.vctSampleData.begin(),
+                stcDat.vctSampleData.end(),
+                f64TriggerUs,
+                [](stcSampleDataType const& stcSampleData, float64_t const f64TimeUs) {
+                    return (!(stcSampleData.f64TimestampUs >= f64TimeUs));
+                }
+            );
+            return static_cast<uint64_t>(objFindResult - stcDat.vctSampleData.begin());
+        }
+
+        // Monotonic time in nanoseconds (for parse statistics)
+        uint64_t
+            getTimeNs(
+                void
+            ) {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()
+                ).count());
+        }
+    }
+
+    static error::enmErrorType
+        parseConfigText(
+            std::string_view objSvBuf,
+            stcConfigFileType& stcCfgOut,
+            bool const bHeaderOnly
+        ) {
+        // Lines and tokens are views into the buffer and numbers are parsed with
+        // `std::from_chars`, so the only allocations are made by the output structure itself (and
+        // none when it is reused with enough capacity). Channel definitions are skipped over
+        // without being tokenized when `bHeaderOnly` is set.
 
         /* Variables for parsing */
         error::enmErrorType enmErrRet = error::enmErrorNone;
-        std::string strLine;
+        std::string_view objSvLine;
+        std::string_view objSvToken;
         char const chrDelim = ',';
-        std::vector<std::string> vctStrTokens;
 
         /* Parse station, device, and version */
-        std::getline(objIfsCfg, strLine);
-        error::enmErrorType enmErrTok = utils::tokenizeString(
-            strLine,
-            chrDelim,
-            vctStrTokens
-        );
-        if (error::enmErrorNone != enmErrTok) {
-            enmErrRet = enmErrTok;
+        if (!utils::popLine(objSvBuf, objSvLine)) {
+            enmErrRet = error::enmErrorInvalidArg;
+            goto cleanup;
+        }
+        enmErrRet = popString(objSvLine, chrDelim, stcCfgOut.strStationName);
+        if (error::enmErrorNone != enmErrRet) {
+            goto cleanup;
+        }
+        enmErrRet = popString(objSvLine, chrDelim, stcCfgOut.strDeviceId);
+        if (error::enmErrorNone != enmErrRet) {
             goto cleanup;
         }
-        stcCfgOut.strStationName = vctStrTokens[0];
-        stcCfgOut.strDeviceId = vctStrTokens[1];
-        stcCfgOut.u16Version = static_cast<uint16_t>(std::stoi(vctStrTokens[2]));
+        // "rev_year" is absent from 1991 files
+        stcCfgOut.u16Version = 1991;
+        if (utils::popToken(objSvLine, chrDelim, objSvToken)) {
+            enmErrRet = utils::parseNumber(objSvToken, stcCfgOut.u16Version);
+            if (error::enmErrorNone != enmErrRet) {
+                goto cleanup;
+            }
+        }
 
         /* Parse channel counts */
-        std::getline(objIfsCfg, strLine);
-        enmErrTok = utils::tokenizeString(
-            strLine,
-            chrDelim,
-            vctStrTokens
-        );
-        if (error::enmErrorNone != enmErrTok) {
-            enmErrRet = enmErrTok;
+        if (!utils::popLine(objSvBuf, objSvLine)) {
+            enmErrRet = error::enmErrorInvalidArg;
+            goto cleanup;
+        }
+        enmErrRet = popNumber(objSvLine, chrDelim, stcCfgOut.u32NumChannels);
+        if (error::enmErrorNone != enmErrRet) {
+            goto cleanup;
+        }
+        // "##A" and "##D" carry a type suffix (e.g., `4A`, `3D`)
+        if (
+            (!utils::popToken(objSvLine, chrDelim, objSvToken))
+            || objSvToken.empty()
+            || ('A' != objSvToken.back())
+            ) {
+            enmErrRet = error::enmErrorInvalidArg;
+            goto cleanup;
+        }
+        enmErrRet = utils::parseNumber(objSvToken.substr(0, (objSvToken.size() - 1)), stcCfgOut.u32NumAnaChannels);
+        if (error::enmErrorNone != enmErrRet) {
+            goto cleanup;
+        }
+        if (
+            (!utils::popToken(objSvLine, chrDelim, objSvToken))
+            || objSvToken.empty()
+            || ('D' != objSvToken.back())
+            ) {
+            enmErrRet = error::enmErrorInvalidArg;
+            goto cleanup;
+        }
+        enmErrRet = utils::parseNumber(objSvToken.substr(0, (objSvToken.size() - 1)), stcCfgOut.u32NumDigChannels);
+        if (error::enmErrorNone != enmErrRet) {
             goto cleanup;
         }
-        stcCfgOut.u32NumChannels = static_cast<uint32_t>(std::stoi(vctStrTokens[0]));
-        stcCfgOut.u32NumAnaChannels = static_cast<uint32_t>(std::stoi(vctStrTokens[1]));
-        stcCfgOut.u32NumDigChannels = static_cast<uint32_t>(std::stoi(vctStrTokens[2]));
 
         /* Parse analog channel information */
         {
             size_t const sizNumAnaChan = static_cast<size_t>(stcCfgOut.u32NumAnaChannels);
+            stcCfgOut.objVmAnalogChannelInfo.clear();
+            stcCfgOut.objVmAnalogChannelInfo.reserve(sizNumAnaChan);
+            stcCfgOut.vctAnaScaling.clear();
+            stcCfgOut.vctAnaScaling.reserve(sizNumAnaChan);
+            stcAnalogChannelInfoType stcAnaChanInfo{};
             for (size_t sizIter = 0; sizNumAnaChan > sizIter; ++sizIter) {
-                std::getline(objIfsCfg, strLine);
-                enmErrTok = utils::tokenizeString(
-                    strLine,
-                    chrDelim,
-                    vctStrTokens
+                if (!utils::popLine(objSvBuf, objSvLine)) {
+                    enmErrRet = error::enmErrorInvalidArg;
+                    goto cleanup;
+                }
+                if (bHeaderOnly) {
+                    continue;
+                }
+
+                enmErrRet = popChannelInfo(objSvLine, stcAnaChanInfo.stcChannelInfo);
+                if (error::enmErrorNone == enmErrRet) {
+                    enmErrRet = popString(objSvLine, chrDelim, stcAnaChanInfo.strUnit);
+                }
+                if (error::enmErrorNone == enmErrRet) {
+                    enmErrRet = popNumber(objSvLine, chrDelim, stcAnaChanInfo.f64ConvA);
+                }
+                if (error::enmErrorNone == enmErrRet) {
+                    enmErrRet = popNumber(objSvLine, chrDelim, stcAnaChanInfo.f64ConvB);
+                }
+                if (error::enmErrorNone != enmErrRet) {
+                    goto cleanup;
+                }
+
+                // skew (ignored), min, max (not enforced, so older files leaving them out still parse)
+                popOptionalNumber(objSvLine, chrDelim);
+                stcAnaChanInfo.f64RawMin = popOptionalNumber(objSvLine, chrDelim);
+                stcAnaChanInfo.f64RawMax = popOptionalNumber(objSvLine, chrDelim);
+
+                // Validate unit once and fuse its prefix into the scaling plan
+                float64_t f64EngUnitConv = 0.0;
+                enmErrRet = getUnitConversion(
+                    stcAnaChanInfo.strUnit,
+                    f64EngUnitConv
                 );
-                if (error::enmErrorNone != enmErrTok) {
-                    enmErrRet = enmErrTok;
+                if (error::enmErrorNone != enmErrRet) {
                     goto cleanup;
                 }
+                stcCfgOut.vctAnaScaling.push_back(stcAnalogScalingType{
+                    (f64EngUnitConv * stcAnaChanInfo.f64ConvA),
+                    (f64EngUnitConv * stcAnaChanInfo.f64ConvB)
+                });
 
-                stcAnalogChannelInfoType stcAnaChanInfo{};
-                stcAnaChanInfo.stcChannelInfo.u32Index = static_cast<uint32_t>(std::stoi(vctStrTokens[0]));
-                stcAnaChanInfo.stcChannelInfo.strName = vctStrTokens[1];
-                stcAnaChanInfo.stcChannelInfo.chrPhase = static_cast<char>(vctStrTokens[2].front());
-                stcAnaChanInfo.stcChannelInfo.strCircuitId = vctStrTokens[3];
-                stcAnaChanInfo.strUnit = vctStrTokens[4];
-                stcAnaChanInfo.f64ConvA = std::stod(vctStrTokens[5]);
-                stcAnaChanInfo.f64ConvB = std::stod(vctStrTokens[6]);
                 stcCfgOut.objVmAnalogChannelInfo.insert(
                     stcAnaChanInfo.stcChannelInfo.strName,
                     stcAnaChanInfo
                 );
-
             }
         }
 
         /* Parse digital channel information */
         {
             size_t const sizNumDigChan = static_cast<size_t>(stcCfgOut.u32NumDigChannels);
-            if (0 < sizNumDigChan) {
-                std::cerr << "? ? ? INFO ? ? ? Digital channels not supported. Ignoring..." << std::endl;
-            }
+            stcCfgOut.objVmDigitalChannelInfo.clear();
+            stcCfgOut.objVmDigitalChannelInfo.reserve(sizNumDigChan);
+            stcDigitalChannelInfoType stcDigChanInfo{};
             for (size_t sizIter = 0; sizNumDigChan > sizIter; ++sizIter) {
-                std::getline(objIfsCfg, strLine);
+                if (!utils::popLine(objSvBuf, objSvLine)) {
+                    enmErrRet = error::enmErrorInvalidArg;
+                    goto cleanup;
+                }
+                if (bHeaderOnly) {
+                    continue;
+                }
+
+                uint32_t u32InServiceState = 0;
+                enmErrRet = popChannelInfo(objSvLine, stcDigChanInfo.stcChannelInfo);
+                if (error::enmErrorNone == enmErrRet) {
+                    enmErrRet = popNumber(objSvLine, chrDelim, u32InServiceState);
+                }
+                if (error::enmErrorNone != enmErrRet) {
+                    goto cleanup;
+                }
+                stcDigChanInfo.bInServiceState = (0 != u32InServiceState);
+
+                stcCfgOut.objVmDigitalChannelInfo.insert(
+                    stcDigChanInfo.stcChannelInfo.strName,
+                    stcDigChanInfo
+                );
             }
         }
 
         /* Parse mains frequency */
-        std::getline(objIfsCfg, strLine);
-        enmErrTok = utils::tokenizeString(
-            strLine,
-            chrDelim,
-            vctStrTokens
-        );
-        if (error::enmErrorNone != enmErrTok) {
-            enmErrRet = enmErrTok;
+        if (!utils::popLine(objSvBuf, objSvLine)) {
+            enmErrRet = error::enmErrorInvalidArg;
+            goto cleanup;
+        }
+        enmErrRet = popNumber(objSvLine, chrDelim, stcCfgOut.f32Frequency);
+        if (error::enmErrorNone != enmErrRet) {
             goto cleanup;
         }
-        stcCfgOut.f32Frequency = std::stof(vctStrTokens[0]);
 
         /* Parse sampling rate count */
-        std::getline(objIfsCfg, strLine);
-        enmErrTok = utils::tokenizeString(
-            strLine,
-            chrDelim,
-            vctStrTokens
-        );
-        if (error::enmErrorNone != enmErrTok) {
-            enmErrRet = enmErrTok;
+        if (!utils::popLine(objSvBuf, objSvLine)) {
+            enmErrRet = error::enmErrorInvalidArg;
+            goto cleanup;
+        }
+        enmErrRet = popNumber(objSvLine, chrDelim, stcCfgOut.u32NumSamplingRates);
+        if (error::enmErrorNone != enmErrRet) {
             goto cleanup;
         }
-        stcCfgOut.u32NumSamplingRates = static_cast<uint32_t>(std::stoi(vctStrTokens[0]));
 
         /* Parse sampling rates and sample counts */
         {
-            size_t const sizNumSamplingRates = static_cast<size_t>(stcCfgOut.u32NumSamplingRates);
+            // "nrates" of 0 means no fixed rate, but a single "0,endsamp" line still follows
+            size_t const sizNumSamplingRates = std::max(
+                static_cast<size_t>(1),
+                static_cast<size_t>(stcCfgOut.u32NumSamplingRates)
+            );
+            stcCfgOut.vctSamplingRateInfo.clear();
             for (size_t sizIter = 0; sizNumSamplingRates > sizIter; ++sizIter) {
-                std::getline(objIfsCfg, strLine);
-                enmErrTok = utils::tokenizeString(
-                    strLine,
-                    chrDelim,
-                    vctStrTokens
-                );
-                if (error::enmErrorNone != enmErrTok) {
-                    enmErrRet = enmErrTok;
+                if (!utils::popLine(objSvBuf, objSvLine)) {
+                    enmErrRet = error::enmErrorInvalidArg;
                     goto cleanup;
                 }
 
-                stcCfgOut.vctSamplingRateInfo.push_back(stcSamplingRateInfoType{});
-                stcCfgOut.vctSamplingRateInfo[sizIter].f64SamplesPerSec = std::stod(vctStrTokens[0]);
-                stcCfgOut.vctSamplingRateInfo[sizIter].u64LastSampleNumber = static_cast<uint64_t>(std::stoull(vctStrTokens[1]));
+                stcSamplingRateInfoType stcRateInfo{};
+                enmErrRet = popNumber(objSvLine, chrDelim, stcRateInfo.f64SamplesPerSec);
+                if (error::enmErrorNone == enmErrRet) {
+                    enmErrRet = popNumber(objSvLine, chrDelim, stcRateInfo.u64LastSampleNumber);
+                }
+                if (error::enmErrorNone != enmErrRet) {
+                    goto cleanup;
+                }
+                stcCfgOut.vctSamplingRateInfo.push_back(stcRateInfo);
             }
         }
 
-        /* Parse starting timestamp */
-        std::getline(objIfsCfg, strLine);
-        enmErrTok = utils::tokenizeString(
-            strLine,
-            chrDelim,
-            vctStrTokens
-        );
-        if (error::enmErrorNone != enmErrTok) {
-            enmErrRet = enmErrTok;
-            goto cleanup;
-        }
-        // Parse starting date
+        /* Build sample segment table */
         {
-            std::vector<std::string> vctStrDate;
-            enmErrTok = utils::tokenizeString(
-                vctStrTokens[0],
-                '/',
-                vctStrDate
-            );
-            if (error::enmErrorNone != enmErrTok) {
-                enmErrRet = enmErrTok;
-                goto cleanup;
+            stcCfgOut.vctSampleSegments.clear();
+            stcCfgOut.bFixedRate = true;
+            uint64_t u64FirstSampleIdx = 0;
+            float64_t f64PrevLastTimeUs = 0.0;
+            for (stcSamplingRateInfoType const& stcRateInfo : stcCfgOut.vctSamplingRateInfo) {
+                if (
+                    (u64FirstSampleIdx >= stcRateInfo.u64LastSampleNumber)
+                    || (0.0 > stcRateInfo.f64SamplesPerSec)
+                    ) {
+                    // Empty segment, or segments out of order
+                    enmErrRet = error::enmErrorInvalidArg;
+                    goto cleanup;
+                }
+
+                // Each sample follows its predecessor by the period of its own segment's rate
+                stcSampleSegmentType stcSegment{};
+                stcSegment.u64FirstSampleIdx = u64FirstSampleIdx;
+                stcSegment.u64EndSampleIdx = stcRateInfo.u64LastSampleNumber;
+                stcSegment.f64SamplesPerSec = stcRateInfo.f64SamplesPerSec;
+                stcCfgOut.bFixedRate = (stcCfgOut.bFixedRate && (0.0 < stcSegment.f64SamplesPerSec));
+                if (0.0 < stcSegment.f64SamplesPerSec) {
+                    float64_t const f64PeriodUs = (1.0e+06 / stcSegment.f64SamplesPerSec);
+                    stcSegment.f64FirstTimeUs = stcCfgOut.vctSampleSegments.empty()
+                        ? 0.0
+                        : (f64PrevLastTimeUs + f64PeriodUs);
+                    f64PrevLastTimeUs = (
+                        stcSegment.f64FirstTimeUs
+                        + (f64PeriodUs * static_cast<float64_t>(stcSegment.u64EndSampleIdx - stcSegment.u64FirstSampleIdx - 1))
+                        );
+                }
+                stcCfgOut.vctSampleSegments.push_back(stcSegment);
+
+                u64FirstSampleIdx = stcRateInfo.u64LastSampleNumber;
             }
-            stcCfgOut.stcDateTimeStart.stcDate.u8Day = static_cast<uint8_t>(std::stoi(vctStrDate[0]));
-            stcCfgOut.stcDateTimeStart.stcDate.u8Month = static_cast<uint8_t>(std::stoi(vctStrDate[1]));
-            stcCfgOut.stcDateTimeStart.stcDate.u16Year = static_cast<uint16_t>(std::stoi(vctStrDate[2]));
+            stcCfgOut.u64TotalSamples = u64FirstSampleIdx;
         }
-        // Parse starting time
-        {
-            std::vector<std::string> vctStrTime;
-            enmErrTok = utils::tokenizeString(
-                vctStrTokens[1],
-                ':',
-                vctStrTime
-            );
-            if (error::enmErrorNone != enmErrTok) {
-                enmErrRet = enmErrTok;
-                goto cleanup;
-            }
-            stcCfgOut.stcDateTimeStart.stcTime.u8Hour = static_cast<uint8_t>(std::stoi(vctStrTime[0]));
-            stcCfgOut.stcDateTimeStart.stcTime.u8Minute = static_cast<uint8_t>(std::stoi(vctStrTime[1]));
-            stcCfgOut.stcDateTimeStart.stcTime.f64Second = std::stod(vctStrTime[2]);
+
+        /* Parse starting timestamp */
+        if (!utils::popLine(objSvBuf, objSvLine)) {
+            enmErrRet = error::enmErrorInvalidArg;
+            goto cleanup;
+        }
+        enmErrRet = popDateTime(objSvLine, stcCfgOut.stcDateTimeStart);
+        if (error::enmErrorNone != enmErrRet) {
+            goto cleanup;
         }
 
         /* Parse trigger timestamp */
-        std::getline(objIfsCfg, strLine);
-        enmErrTok = utils::tokenizeString(
-            strLine,
-            chrDelim,
-            vctStrTokens
-        );
-        if (error::enmErrorNone != enmErrTok) {
-            enmErrRet = enmErrTok;
+        if (!utils::popLine(objSvBuf, objSvLine)) {
+            enmErrRet = error::enmErrorInvalidArg;
             goto cleanup;
         }
-        // Parse trigger date
-        {
-            std::vector<std::string> vctStrDate;
-            enmErrTok = utils::tokenizeString(
-                vctStrTokens[0],
-                '/',
-                vctStrDate
-            );
-            if (error::enmErrorNone != enmErrTok) {
-                enmErrRet = enmErrTok;
-                goto cleanup;
-            }
-            stcCfgOut.stcDateTimeTrigger.stcDate.u8Day = static_cast<uint8_t>(std::stoi(vctStrDate[0]));
-            stcCfgOut.stcDateTimeTrigger.stcDate.u8Month = static_cast<uint8_t>(std::stoi(vctStrDate[1]));
-            stcCfgOut.stcDateTimeTrigger.stcDate.u16Year = static_cast<uint16_t>(std::stoi(vctStrDate[2]));
-        }
-        // Parse trigger time
-        {
-            std::vector<std::string> vctStrTime;
-            enmErrTok = utils::tokenizeString(
-                vctStrTokens[1],
-                ':',
-                vctStrTime
-            );
-            if (error::enmErrorNone != enmErrTok) {
-                enmErrRet = enmErrTok;
-                goto cleanup;
-            }
-            stcCfgOut.stcDateTimeTrigger.stcTime.u8Hour = static_cast<uint8_t>(std::stoi(vctStrTime[0]));
-            stcCfgOut.stcDateTimeTrigger.stcTime.u8Minute = static_cast<uint8_t>(std::stoi(vctStrTime[1]));
-            stcCfgOut.stcDateTimeTrigger.stcTime.f64Second = std::stod(vctStrTime[2]);
+        enmErrRet = popDateTime(objSvLine, stcCfgOut.stcDateTimeTrigger);
+        if (error::enmErrorNone != enmErrRet) {
+            goto cleanup;
         }
 
         /* Parse data file format */
-        std::getline(objIfsCfg, strLine);
-        enmErrTok = utils::tokenizeString(
-            strLine,
-            chrDelim,
-            vctStrTokens
-        );
-        if (error::enmErrorNone != enmErrTok) {
-            enmErrRet = enmErrTok;
+        if (
+            (!utils::popLine(objSvBuf, objSvLine))
+            || (!utils::popToken(objSvLine, chrDelim, objSvToken))
+            ) {
+            enmErrRet = error::enmErrorInvalidArg;
             goto cleanup;
         }
-        if (0 == vctStrTokens[0].compare("ASCII")) {
+        if ("ASCII" == objSvToken) {
             stcCfgOut.enmDataFileFormat = enmDataFileFormatAscii;
         }
-        else if (0 == vctStrTokens[0].compare("BINARY")) {
+        else if ("BINARY" == objSvToken) {
             stcCfgOut.enmDataFileFormat = enmDataFileFormatBinary;
         }
+        else if ("BINARY32" == objSvToken) {
+            stcCfgOut.enmDataFileFormat = enmDataFileFormatBinary32;
+        }
+        else if ("FLOAT32" == objSvToken) {
+            stcCfgOut.enmDataFileFormat = enmDataFileFormatFloat32;
+        }
         else {
             enmErrRet = error::enmErrorInvalidArg;
             goto cleanup;
         }
 
         /* Parse time base multiplier */
-        std::getline(objIfsCfg, strLine);
-        enmErrTok = utils::tokenizeString(
-            strLine,
-            chrDelim,
-            vctStrTokens
-        );
-        if (error::enmErrorNone != enmErrTok) {
-            enmErrRet = enmErrTok;
+        if (!utils::popLine(objSvBuf, objSvLine)) {
+            enmErrRet = error::enmErrorInvalidArg;
+            goto cleanup;
+        }
+        enmErrRet = popNumber(objSvLine, chrDelim, stcCfgOut.f64TimeMult);
+        if (error::enmErrorNone != enmErrRet) {
             goto cleanup;
         }
-        stcCfgOut.f64TimeMult = std::stod(vctStrTokens[0]);
-
-        /* Mark initialized */
-        stcCfgOut.bInit = true;
 
     cleanup:
-        std::cout << " Done." << std::endl;
-        objIfsCfg.close();
-        return printCodeIfError(enmErrRet);
+        return enmErrRet;
     }
 
+
     error::enmErrorType
-        printConfigInfo(
-            stcConfigFileType const& stcCfg
+        parseConfigFile(
+            std::string const& strFileNamePrefix,
+            stcConfigFileType& stcCfgOut
         ) {
-        std::cout << std::endl;
+        if (strFileNamePrefix.empty()) {
+            return error::enmErrorInvalidArg;
+        }
 
-        std::cout << "Station: " << stcCfg.strStationName << std::endl;
-        std::cout << "Device ID: " << stcCfg.strDeviceId << std::endl;
-        std::cout << "Version: " << stcCfg.u16Version << std::endl;
-        std::cout << std::endl;
+        /* Un-initialize configuration data */
+        stcCfgOut.bInit = false;
 
-        std::cout << "Total Channel Count: " << stcCfg.u32NumChannels << std::endl;
-        std::cout << "Analog Channel Count: " << stcCfg.u32NumAnaChannels << std::endl;
-        std::cout << "Digital Channel Count: " << stcCfg.u32NumDigChannels << std::endl;
-        std::cout << std::endl;
+        /* Open configuration file (mapped, so it is scanned in place) */
+        stcCfgOut.strCfgFileName.assign(strFileNamePrefix).append(".CFG");
+        mf::clsMappedFile objMfCfg;
+        error::enmErrorType enmErrOpen = utils::openFile(
+            stcCfgOut.strCfgFileName,
+            objMfCfg
+        );
+        if (error::enmErrorNone != enmErrOpen) {
+            return enmErrOpen;
+        }
 
-        std::cout << "Analog Channel Info:" << std::endl;
-        size_t const sizNumAnaChan = static_cast<size_t>(stcCfg.u32NumAnaChannels);
-        for (size_t sizIter = 0; sizNumAnaChan > sizIter; ++sizIter) {
-            std::cout << "\tIndex: " << stcCfg.objVmAnalogChannelInfo[sizIter].stcChannelInfo.u32Index << std::endl;
-            std::cout << "\t\tName: " << stcCfg.objVmAnalogChannelInfo[sizIter].stcChannelInfo.strName << std::endl;
-            std::cout << "\t\tPhase: " << stcCfg.objVmAnalogChannelInfo[sizIter].stcChannelInfo.chrPhase << std::endl;
-            std::cout << "\t\tCircuit ID: " << stcCfg.objVmAnalogChannelInfo[sizIter].stcChannelInfo.strCircuitId << std::endl;
-            std::cout << "\t\tUnit: " << stcCfg.objVmAnalogChannelInfo[sizIter].strUnit << std::endl;
-            std::cout << "\t\tConversion Factor A: " << std::scientific << std::setprecision(10) << stcCfg.objVmAnalogChannelInfo[sizIter].f64ConvA << std::endl;
-            std::cout << "\t\tConversion Factor B: " << std::scientific << std::setprecision(10) << stcCfg.objVmAnalogChannelInfo[sizIter].f64ConvB << std::endl;
-            std::cout << std::endl;
+        /* Validate data file */
+        stcCfgOut.strDatFileName.assign(strFileNamePrefix).append(".DAT");
+        std::ifstream objIfsDat;
+        enmErrOpen = utils::openFile(
+            stcCfgOut.strDatFileName,
+            std::ifstream::in,
+            objIfsDat
+        );
+        objIfsDat.close();
+        if (error::enmErrorNone != enmErrOpen) {
+            return enmErrOpen;
         }
 
-        std::cout << "Mains Frequency (Hz): " << std::fixed << std::setprecision(6) << stcCfg.f32Frequency << std::endl;
-        std::cout << "Sampling Rate Count: " << stcCfg.u32NumSamplingRates << std::endl;
+        /* Parse configuration file */
+        error::enmErrorType const enmErrRet = parseConfigText(
+            std::string_view(objMfCfg.data(), static_cast<size_t>(objMfCfg.size())),
+            stcCfgOut,
+            false
+        );
+        objMfCfg.close();
 
-        size_t const sizNumSamplingRates = static_cast<size_t>(stcCfg.u32NumSamplingRates);
-        for (size_t sizIter = 0; sizNumSamplingRates > sizIter; ++sizIter) {
-            std::cout << "\tIndex: " << (1 + sizIter) << std::endl;
-            std::cout << "\t\tSampling Rate (Hz): " << std::fixed << std::setprecision(10) << stcCfg.vctSamplingRateInfo[sizIter].f64SamplesPerSec << std::endl;
-            std::cout << "\t\tLast Sample: " << stcCfg.vctSamplingRateInfo[sizIter].u64LastSampleNumber << std::endl;
-            std::cout << std::endl;
+        /* Mark initialized */
+        stcCfgOut.bInit = (error::enmErrorNone == enmErrRet);
+
+        if (error::enmErrorNone == enmErrRet) {
+            DIAG_LOG(diag::enmLevelInfo, ("Parsed configuration file " + stcCfgOut.strCfgFileName));
+        }
+        else {
+            DIAG_LOG(
+                diag::enmLevelWarning,
+                ("Cannot parse configuration file " + stcCfgOut.strCfgFileName + ": " + error::getMessage(enmErrRet))
+            );
         }
+        return enmErrRet;
+    }
 
-        uint32_t const u32StartYear = static_cast<uint32_t>(stcCfg.stcDateTimeStart.stcDate.u16Year);
-        uint32_t const u32StartMonth = static_cast<uint32_t>(stcCfg.stcDateTimeStart.stcDate.u8Month);
-        uint32_t const u32StartDay = static_cast<uint32_t>(stcCfg.stcDateTimeStart.stcDate.u8Day);
-        uint32_t const u32StartHour = static_cast<uint32_t>(stcCfg.stcDateTimeStart.stcTime.u8Hour);
-        uint32_t const u32StartMinute = static_cast<uint32_t>(stcCfg.stcDateTimeStart.stcTime.u8Minute);
-        float64_t const f64StartSecond = stcCfg.stcDateTimeStart.stcTime.f64Second;
+    error::enmErrorType
+        parseConfigHeader(
+            std::string const& strCfgFileName,
+            stcConfigFileType& stcCfgOut
+        ) {
+        if (strCfgFileName.empty()) {
+            return error::enmErrorInvalidArg;
+        }
+
+        /* Un-initialize configuration data (header-only results are never marked initialized) */
+        stcCfgOut.bInit = false;
+
+        /* Open configuration file (mapped, so it is scanned in place) */
+        stcCfgOut.strCfgFileName = strCfgFileName;
+        stcCfgOut.strDatFileName.clear();
+        mf::clsMappedFile objMfCfg;
+        error::enmErrorType const enmErrOpen = utils::openFile(
+            stcCfgOut.strCfgFileName,
+            objMfCfg
+        );
+        if (error::enmErrorNone != enmErrOpen) {
+            return enmErrOpen;
+        }
+
+        /* Parse configuration file (header fields only) */
+        return parseConfigText(
+            std::string_view(objMfCfg.data(), static_cast<size_t>(objMfCfg.size())),
+            stcCfgOut,
+            true
+        );
+    }
+
+    uint32_t
+        getBinarySampleSizeBytes(
+            stcConfigFileType const& stcCfg
+        ) {
+        return static_cast<uint32_t>(
+            // sample number
+            (4)
+            // timestamp
+            + (4)
+            // analog channels (two bytes each for BINARY, four for BINARY32 and FLOAT32)
+            + (((enmDataFileFormatBinary == stcCfg.enmDataFileFormat) ? 2 : 4) * stcCfg.u32NumAnaChannels)
+            // digital channels (16 per status word, rounded up)
+            + (2 * ((stcCfg.u32NumDigChannels + 15) / 16))
+            );
+    }
+
+    error::enmErrorType
+        printConfigInfo(
+            stcConfigFileType const& stcCfg
+        ) {
+        std::cout << std::endl;
+
+        std::cout << "Station: " << stcCfg.strStationName << std::endl;
+        std::cout << "Device ID: " << stcCfg.strDeviceId << std::endl;
+        std::cout << "Version: " << stcCfg.u16Version << std::endl;
+        std::cout << std::endl;
+
+        std::cout << "Total Channel Count: " << stcCfg.u32NumChannels << std::endl;
+        std::cout << "Analog Channel Count: " << stcCfg.u32NumAnaChannels << std::endl;
+        std::cout << "Digital Channel Count: " << stcCfg.u32NumDigChannels << std::endl;
+        std::cout << std::endl;
+
+        std::cout << "Analog Channel Info:" << std::endl;
+        size_t const sizNumAnaChan = static_cast<size_t>(stcCfg.u32NumAnaChannels);
+        for (size_t sizIter = 0; sizNumAnaChan > sizIter; ++sizIter) {
+            stcAnalogChannelInfoType const& stcAnaChanInfo = stcCfg.objVmAnalogChannelInfo[sizIter];
+            std::cout << "\tIndex: " << stcAnaChanInfo.stcChannelInfo.u32Index << std::endl;
+            std::cout << "\t\tName: " << stcAnaChanInfo.stcChannelInfo.strName << std::endl;
+            std::cout << "\t\tPhase: " << stcAnaChanInfo.stcChannelInfo.chrPhase << std::endl;
+            std::cout << "\t\tCircuit ID: " << stcAnaChanInfo.stcChannelInfo.strCircuitId << std::endl;
+            std::cout << "\t\tUnit: " << stcAnaChanInfo.strUnit << std::endl;
+            std::cout << "\t\tConversion Factor A: " << std::scientific << std::setprecision(10) << stcAnaChanInfo.f64ConvA << std::endl;
+            std::cout << "\t\tConversion Factor B: " << std::scientific << std::setprecision(10) << stcAnaChanInfo.f64ConvB << std::endl;
+            std::cout << "\t\tRange (raw): " << std::defaultfloat << stcAnaChanInfo.f64RawMin << " to " << stcAnaChanInfo.f64RawMax << std::endl;
+            std::cout << std::endl;
+        }
+
+        std::cout << "Digital Channel Info:" << std::endl;
+        size_t const sizNumDigChan = static_cast<size_t>(stcCfg.u32NumDigChannels);
+        for (size_t sizIter = 0; sizNumDigChan > sizIter; ++sizIter) {
+            stcDigitalChannelInfoType const& stcDigChanInfo = stcCfg.objVmDigitalChannelInfo[sizIter];
+            std::cout << "\tIndex: " << stcDigChanInfo.stcChannelInfo.u32Index << std::endl;
+            std::cout << "\t\tName: " << stcDigChanInfo.stcChannelInfo.strName << std::endl;
+            std::cout << "\t\tPhase: " << stcDigChanInfo.stcChannelInfo.chrPhase << std::endl;
+            std::cout << "\t\tCircuit ID: " << stcDigChanInfo.stcChannelInfo.strCircuitId << std::endl;
+            std::cout << "\t\tNormal State: " << stcDigChanInfo.bInServiceState << std::endl;
+            std::cout << std::endl;
+        }
+
+        std::cout << "Mains Frequency (Hz): " << std::fixed << std::setprecision(6) << stcCfg.f32Frequency << std::endl;
+        std::cout << "Sampling Rate Count: " << stcCfg.u32NumSamplingRates << std::endl;
+
+        size_t const sizNumSamplingRates = static_cast<size_t>(stcCfg.u32NumSamplingRates);
+        for (size_t sizIter = 0; sizNumSamplingRates > sizIter; ++sizIter) {
+            std::cout << "\tIndex: " << (1 + sizIter) << std::endl;
+            std::cout << "\t\tSampling Rate (Hz): " << std::fixed << std::setprecision(10) << stcCfg.vctSamplingRateInfo[sizIter].f64SamplesPerSec << std::endl;
+            std::cout << "\t\tLast Sample: " << stcCfg.vctSamplingRateInfo[sizIter].u64LastSampleNumber << std::endl;
+            std::cout << std::endl;
+        }
+
+        uint32_t const u32StartYear = static_cast<uint32_t>(stcCfg.stcDateTimeStart.stcDate.u16Year);
+        uint32_t const u32StartMonth = static_cast<uint32_t>(stcCfg.stcDateTimeStart.stcDate.u8Month);
+        uint32_t const u32StartDay = static_cast<uint32_t>(stcCfg.stcDateTimeStart.stcDate.u8Day);
+        uint32_t const u32StartHour = static_cast<uint32_t>(stcCfg.stcDateTimeStart.stcTime.u8Hour);
+        uint32_t const u32StartMinute = static_cast<uint32_t>(stcCfg.stcDateTimeStart.stcTime.u8Minute);
+        float64_t const f64StartSecond = stcCfg.stcDateTimeStart.stcTime.f64Second;
         std::cout << "Start Date: " << std::setw(4) << std::setfill('0') << u32StartYear << "-"
             << std::setw(2) << std::setfill('0') << u32StartMonth << "-"
             << std::setw(2) << std::setfill('0') << u32StartDay
@@ -438,230 +822,2067 @@ namespace comtrade {
         if (enmDataFileFormatAscii == stcCfg.enmDataFileFormat) {
             std::cout << "ASCII" << std::endl;
         }
-        else if (enmDataFileFormatBinary == stcCfg.enmDataFileFormat) {
-            std::cout << "Binary" << std::endl;
+        else if (enmDataFileFormatBinary == stcCfg.enmDataFileFormat) {
+            std::cout << "Binary" << std::endl;
+        }
+        else if (enmDataFileFormatBinary32 == stcCfg.enmDataFileFormat) {
+            std::cout << "Binary (32 bit)" << std::endl;
+        }
+        else if (enmDataFileFormatFloat32 == stcCfg.enmDataFileFormat) {
+            std::cout << "Floating point (32 bit)" << std::endl;
+        }
+        else {
+            return error::enmErrorInvalidArg;
+        }
+
+        std::cout << "Time Base (sec): " << std::fixed << std::setprecision(6) << stcCfg.f64TimeMult << std::endl;
+
+        std::cout << std::endl;
+
+        return error::enmErrorNone;
+    }
+
+
+    template <typename typValueType>
+    static size_t
+        getColumnCount(
+            size_t const sizCount
+        ) {
+        // Columns a multiple of 4 KiB apart map to the same cache sets, so writing many of them at
+        // once (as the decoders do, row by row) keeps evicting them; such columns get one extra
+        // cache line to spread them out (e.g., power-of-two sample counts)
+        size_t const sizPaddedBytes = ar::clsArena::getPaddedSize(sizCount * sizeof(typValueType));
+        return (0 == (sizPaddedBytes % 4096))
+            ? (sizCount + (ar::clsArena::sizAlignBytes / sizeof(typValueType)))
+            : sizCount;
+    }
+
+    static void
+        allocateChannelStorage(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            bool const bAllocChannels
+        ) {
+        size_t const sizTotalSamp = static_cast<size_t>(stcDatOut.u64TotalSamples);
+        size_t const sizNumAnaChan = static_cast<size_t>(stcCfgIn.u32NumAnaChannels);
+        size_t const sizNumDigChan = static_cast<size_t>(stcCfgIn.u32NumDigChannels);
+        size_t const sizNumWords = ((sizTotalSamp + 63) / 64);
+        size_t const sizRawCount = getColumnCount<int32_t>(sizTotalSamp);
+        size_t const sizDataCount = getColumnCount<float64_t>(sizTotalSamp);
+        size_t const sizWordCount = getColumnCount<uint64_t>(sizNumWords);
+
+        /* Drop the previous record's channel data in one step (its memory is reused) */
+        stcDatOut.objArena.reset();
+        if (bAllocChannels) {
+            stcDatOut.objArena.reserve(
+                (sizNumAnaChan * (
+                    ar::clsArena::getPaddedSize(sizRawCount * sizeof(int32_t))
+                    + ar::clsArena::getPaddedSize(sizDataCount * sizeof(float64_t))
+                    ))
+                + (sizNumDigChan * ar::clsArena::getPaddedSize(sizWordCount * sizeof(uint64_t)))
+            );
+        }
+
+        /* Allocate columnar storage (one raw and one scaled array per analog channel) */
+        stcDatOut.vctAnaChanData.clear();
+        stcDatOut.vctAnaChanData.resize(sizNumAnaChan);
+        for (stcAnalogChannelDataType& stcAnaChanData : stcDatOut.vctAnaChanData) {
+            stcAnaChanData.bLoaded = bAllocChannels;
+            if (bAllocChannels) {
+                // Every sample is written by the parser, so no need to clear these
+                stcAnaChanData.ptrI32DataRaw = stcDatOut.objArena.allocate<int32_t>(sizRawCount);
+                stcAnaChanData.ptrF64Data = stcDatOut.objArena.allocate<float64_t>(sizDataCount);
+            }
+        }
+
+        /* Allocate columnar storage (one zeroed bitset per digital channel) */
+        stcDatOut.vctDigChanData.clear();
+        stcDatOut.vctDigChanData.resize(sizNumDigChan);
+        for (stcDigitalChannelDataType& stcDigChanData : stcDatOut.vctDigChanData) {
+            stcDigChanData.bLoaded = bAllocChannels;
+            if (bAllocChannels) {
+                stcDigChanData.ptrU64Bits = stcDatOut.objArena.allocate<uint64_t>(sizWordCount);
+                std::fill_n(stcDigChanData.ptrU64Bits, sizNumWords, 0);
+            }
+        }
+
+        // Every sample is overwritten by the parser, so existing entries are kept as they are
+        stcDatOut.vctSampleData.resize(sizTotalSamp);
+    }
+
+    template <typename typViewType, typename typInfoType>
+    static bool
+        hasChannelNames(
+            vm::clsVectorMap<std::string, typViewType> const& objVmChanData,
+            vm::clsVectorMap<std::string, typInfoType> const& objVmChanInfo
+        ) {
+        /* Check whether an existing channel index already lists the configuration's channels in order */
+        if (objVmChanData.size() != objVmChanInfo.size()) {
+            return false;
+        }
+        for (size_t sizIter = 0; objVmChanInfo.size() > sizIter; ++sizIter) {
+            if (objVmChanData.key(sizIter) != objVmChanInfo[sizIter].stcChannelInfo.strName) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static void
+        indexChannelStorage(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut
+        ) {
+        /* Index channel views over the columnar storage (unloaded channels have no data yet) */
+        //
+        // A record reused for the same channel layout (e.g., the same relay model) keeps its
+        // index and only has its views repointed, so names are neither copied nor hashed again.
+        size_t const sizTotalSamp = static_cast<size_t>(stcDatOut.u64TotalSamples);
+        size_t const sizNumAnaChan = static_cast<size_t>(stcCfgIn.u32NumAnaChannels);
+        bool const bReuseAnaIndex = hasChannelNames(stcDatOut.objVmChanAnaData, stcCfgIn.objVmAnalogChannelInfo);
+        if (!bReuseAnaIndex) {
+            stcDatOut.objVmChanAnaData.clear();
+            stcDatOut.objVmChanAnaData.reserve(sizNumAnaChan);
+        }
+        for (size_t sizIter = 0; sizNumAnaChan > sizIter; ++sizIter) {
+            stcAnalogChannelDataType const& stcAnaChanData = stcDatOut.vctAnaChanData[sizIter];
+            stcAnalogChannelViewType const stcAnaChanView{
+                stcAnaChanData.ptrI32DataRaw,
+                stcAnaChanData.ptrF64Data,
+                sizTotalSamp
+            };
+            if (bReuseAnaIndex) {
+                stcDatOut.objVmChanAnaData.at(sizIter) = stcAnaChanView;
+            }
+            else {
+                stcDatOut.objVmChanAnaData.insert(
+                    stcCfgIn.objVmAnalogChannelInfo[sizIter].stcChannelInfo.strName,
+                    stcAnaChanView
+                );
+            }
+        }
+
+        size_t const sizNumDigChan = static_cast<size_t>(stcCfgIn.u32NumDigChannels);
+        bool const bReuseDigIndex = hasChannelNames(stcDatOut.objVmChanDigData, stcCfgIn.objVmDigitalChannelInfo);
+        if (!bReuseDigIndex) {
+            stcDatOut.objVmChanDigData.clear();
+            stcDatOut.objVmChanDigData.reserve(sizNumDigChan);
+        }
+        for (size_t sizIter = 0; sizNumDigChan > sizIter; ++sizIter) {
+            stcDigitalChannelDataType const& stcDigChanData = stcDatOut.vctDigChanData[sizIter];
+            stcDigitalChannelViewType const stcDigChanView{
+                stcDigChanData.ptrU64Bits,
+                sizTotalSamp
+            };
+            if (bReuseDigIndex) {
+                stcDatOut.objVmChanDigData.at(sizIter) = stcDigChanView;
+            }
+            else {
+                stcDatOut.objVmChanDigData.insert(
+                    stcCfgIn.objVmDigitalChannelInfo[sizIter].stcChannelInfo.strName,
+                    stcDigChanView
+                );
+            }
+        }
+    }
+
+    static void
+        scaleAnalogStorage(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            size_t const sizSampleBegin,
+            size_t const sizSampleEnd
+        ) {
+        /* Convert raw values of a block of samples into engineering units (whole block per channel) */
+        size_t const sizNumAnaChan = static_cast<size_t>(stcCfgIn.u32NumAnaChannels);
+        for (size_t sizIter = 0; sizNumAnaChan > sizIter; ++sizIter) {
+            stcAnalogScalingType const& stcAnaScaling = stcCfgIn.vctAnaScaling[sizIter];
+            stcAnalogChannelDataType& stcAnaChanData = stcDatOut.vctAnaChanData[sizIter];
+            decode::scaleI32ToF64(
+                (stcAnaChanData.ptrI32DataRaw + sizSampleBegin),
+                (sizSampleEnd - sizSampleBegin),
+                stcAnaScaling.f64Mult,
+                stcAnaScaling.f64Offset,
+                (stcAnaChanData.ptrF64Data + sizSampleBegin)
+            );
+        }
+    }
+
+    static void
+        markMissingAsciiValues(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            size_t const sizSampleBegin,
+            size_t const sizSampleEnd
+        ) {
+        /* Replace scaled values of samples marked missing (99999) in a block of samples with NaN */
+        size_t const sizNumAnaChan = static_cast<size_t>(stcCfgIn.u32NumAnaChannels);
+        for (size_t sizIter = 0; sizNumAnaChan > sizIter; ++sizIter) {
+            stcAnalogChannelDataType& stcAnaChanData = stcDatOut.vctAnaChanData[sizIter];
+            for (size_t sizSampleIdx = sizSampleBegin; sizSampleEnd > sizSampleIdx; ++sizSampleIdx) {
+                if (i32MissingValueAscii == stcAnaChanData.ptrI32DataRaw[sizSampleIdx]) {
+                    stcAnaChanData.ptrF64Data[sizSampleIdx] = std::nan("");
+                }
+            }
+        }
+    }
+
+    static char const*
+        scanAsciiField(
+            char const* ptrChrAt,
+            char const* const ptrChrEnd,
+            bool& bEmptyOut,
+            int64_t& i64Out
+        ) {
+        /* Parse one comma-separated integer field, returning a pointer past its delimiter */
+        while ((ptrChrEnd > ptrChrAt) && ((' ' == *ptrChrAt) || ('\t' == *ptrChrAt))) {
+            ++ptrChrAt;
+        }
+
+        bEmptyOut = ((ptrChrEnd == ptrChrAt) || (',' == *ptrChrAt));
+        if (!bEmptyOut) {
+            ptrChrAt = utils::scanI64(ptrChrAt, ptrChrEnd, i64Out);
+            if (nullptr == ptrChrAt) {
+                return nullptr;
+            }
+            while ((ptrChrEnd > ptrChrAt) && ((' ' == *ptrChrAt) || ('\t' == *ptrChrAt))) {
+                ++ptrChrAt;
+            }
+        }
+
+        if (ptrChrEnd == ptrChrAt) {
+            return ptrChrAt;
+        }
+        if (',' != *ptrChrAt) {
+            // Trailing garbage (e.g., a non-integer value)
+            return nullptr;
+        }
+        return (ptrChrAt + 1);
+    }
+
+    static error::enmErrorType
+        parseAsciiSample(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            size_t const sizSampleIdx,
+            char const* const ptrChrBegin,
+            char const* const ptrChrEnd,
+            uint64_t& u64MissingTimestampsInOut,
+            uint64_t& u64MissingValuesInOut
+        ) {
+        char const* ptrChrAt = ptrChrBegin;
+        bool bEmpty = false;
+        int64_t i64Field = 0;
+        stcSampleDataType& stcSampleData = stcDatOut.vctSampleData[sizSampleIdx];
+
+        // Parse sample count
+        ptrChrAt = scanAsciiField(ptrChrAt, ptrChrEnd, bEmpty, i64Field);
+        if ((nullptr == ptrChrAt) || bEmpty) {
+            return error::enmErrorInvalidArg;
+        }
+        if ((0 > i64Field) || (static_cast<int64_t>(std::numeric_limits<uint32_t>::max()) < i64Field)) {
+            // Would wrap (and could then pass the order check)
+            return error::enmErrorInvalidArg;
+        }
+        stcSampleData.u32SampleNumber = static_cast<uint32_t>(i64Field);
+        stcSampleData.u32RowIdx = static_cast<uint32_t>(sizSampleIdx);
+
+        // Validate sample count
+        if ((1 + stcDatOut.u32PrevSampleNumber) != stcSampleData.u32SampleNumber) {
+            return error::emErrorOutOfOrder;
+        }
+        ++stcDatOut.u32PrevSampleNumber;
+
+        // Parse timestamp (may be left blank when the sampling rate is known)
+        ptrChrAt = scanAsciiField(ptrChrAt, ptrChrEnd, bEmpty, i64Field);
+        if (nullptr == ptrChrAt) {
+            return error::enmErrorInvalidArg;
+        }
+        stcSampleData.f64TimestampUs = bEmpty
+            ? std::nan("")
+            : (stcCfgIn.f64TimeMult * static_cast<float64_t>(i64Field));
+        u64MissingTimestampsInOut += (bEmpty ? 1 : 0);
+
+        // Parse analog channel sample data
+        size_t const sizNumAnaChan = static_cast<size_t>(stcCfgIn.u32NumAnaChannels);
+        for (size_t sizIterJ = 0; sizNumAnaChan > sizIterJ; ++sizIterJ) {
+            ptrChrAt = scanAsciiField(ptrChrAt, ptrChrEnd, bEmpty, i64Field);
+            if ((nullptr == ptrChrAt) || bEmpty) {
+                return error::enmErrorInvalidArg;
+            }
+            if (
+                (static_cast<int64_t>(std::numeric_limits<int32_t>::min()) > i64Field)
+                || (static_cast<int64_t>(std::numeric_limits<int32_t>::max()) < i64Field)
+                ) {
+                // Does not fit the raw column
+                return error::enmErrorInvalidArg;
+            }
+            stcDatOut.vctAnaChanData[sizIterJ].ptrI32DataRaw[sizSampleIdx] = static_cast<int32_t>(i64Field);
+            u64MissingValuesInOut += ((i32MissingValueAscii == i64Field) ? 1 : 0);
+        }
+
+        // Parse digital channel sample data
+        size_t const sizNumDigChan = static_cast<size_t>(stcCfgIn.u32NumDigChannels);
+        size_t const sizWordIdx = (sizSampleIdx / 64);
+        uint64_t const u64BitMask = (static_cast<uint64_t>(1) << (sizSampleIdx % 64));
+        for (size_t sizIterJ = 0; sizNumDigChan > sizIterJ; ++sizIterJ) {
+            ptrChrAt = scanAsciiField(ptrChrAt, ptrChrEnd, bEmpty, i64Field);
+            if ((nullptr == ptrChrAt) || bEmpty || (0 > i64Field) || (1 < i64Field)) {
+                return error::enmErrorInvalidArg;
+            }
+            if (0 != i64Field) {
+                stcDatOut.vctDigChanData[sizIterJ].ptrU64Bits[sizWordIdx] |= u64BitMask;
+            }
+        }
+
+        return error::enmErrorNone;
+    }
+
+    static char const*
+        trimAsciiLine(
+            char const* const ptrChrBegin,
+            char const* ptrChrEnd
+        ) {
+        // Trim line ending, trailing whitespace, and DOS end-of-file marker
+        while (
+            (ptrChrEnd > ptrChrBegin)
+            && (
+                ('\r' == ptrChrEnd[-1])
+                || (' ' == ptrChrEnd[-1])
+                || ('\t' == ptrChrEnd[-1])
+                || ('\x1a' == ptrChrEnd[-1])
+                )
+            ) {
+            --ptrChrEnd;
+        }
+        return ptrChrEnd;
+    }
+
+    static error::enmErrorType
+        parseAsciiDataFile(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            std::ifstream& objIfsDat,
+            stcParseOptionsType const& stcOpts,
+            stcParseStatsType& stcStatsOut
+        ) {
+        /* 6.4 ASCII data files */
+        //
+        // Notes
+        //     - one sample per line, fields separated by commas
+        //     - "missing data ... shall be noted by 99999"
+        //
+        // Sequence
+        //     - sample number (integer)
+        //     - timestamp (integer)
+        //     - analog channel sample data (integer)
+        //     - status [digital] channel sample data (0 or 1)
+        //
+        // The file is read in large blocks and each line is scanned in place; a partial line at the
+        // end of a block is carried over to the front of the next one. Lines before a slice are
+        // only skipped, and reading stops at the end of the slice.
+
+        stcDatOut.u32SampleSizeBytes = 0;
+        uint64_t u64TimeNs = getTimeNs();
+        allocateChannelStorage(stcCfgIn, stcDatOut, true);
+        uint64_t u64NowNs = getTimeNs();
+        stcStatsOut.u64IndexNs += (u64NowNs - u64TimeNs);
+
+        uint64_t const u64TotalSamp = stcDatOut.u64TotalSamples;
+        size_t const sizTotalSamp = static_cast<size_t>(u64TotalSamp);
+        uint64_t const u64SkipLines = stcDatOut.u64FirstSampleIdx;
+        // a slice ending before the last sample of the record may stop reading early
+        bool const bStopEarly = ((u64SkipLines + u64TotalSamp) < stcCfgIn.u64TotalSamples);
+        stcDatOut.u32PrevSampleNumber = static_cast<uint32_t>(u64SkipLines);
+
+        std::vector<char> vctChrBuf(static_cast<size_t>(1) << 20);
+        ++stcStatsOut.u64Allocations;
+        size_t sizCarry = 0;
+        uint64_t u64LineIdx = 0;
+        size_t sizSampleIdx = 0;
+        size_t sizScaledIdx = 0;
+        bool bEof = false;
+        // analog values marked missing in the current block
+        uint64_t u64MissingValues = 0;
+
+        uint64_t u64SplitCount = 0;
+
+        while (!bEof) {
+            // Read next block behind any carried-over partial line
+            if (vctChrBuf.size() == sizCarry) {
+                // Line longer than the buffer
+                vctChrBuf.resize(2 * vctChrBuf.size());
+                ++stcStatsOut.u64Allocations;
+            }
+            u64TimeNs = getTimeNs();
+            objIfsDat.read((vctChrBuf.data() + sizCarry), static_cast<std::streamsize>(vctChrBuf.size() - sizCarry));
+            size_t const sizRead = static_cast<size_t>(objIfsDat.gcount());
+            bEof = (0 == sizRead);
+            u64NowNs = getTimeNs();
+            stcStatsOut.u64IoNs += (u64NowNs - u64TimeNs);
+            stcStatsOut.u64BytesRead += sizRead;
+            u64TimeNs = u64NowNs;
+
+            char const* ptrChrAt = vctChrBuf.data();
+            char const* const ptrChrEnd = (vctChrBuf.data() + sizCarry + sizRead);
+
+            while (ptrChrEnd > ptrChrAt) {
+                // Find end of line (the final line of the file may be unterminated)
+                char const* ptrChrEol = static_cast<char const*>(
+                    std::memchr(ptrChrAt, '\n', static_cast<size_t>(ptrChrEnd - ptrChrAt))
+                    );
+                if (nullptr == ptrChrEol) {
+                    if (!bEof) {
+                        break;
+                    }
+                    ptrChrEol = ptrChrEnd;
+                }
+                char const* const ptrChrNext = (ptrChrEnd == ptrChrEol) ? ptrChrEnd : (ptrChrEol + 1);
+
+                ptrChrEol = trimAsciiLine(ptrChrAt, ptrChrEol);
+
+                if ((ptrChrEol > ptrChrAt) && (u64SkipLines > u64LineIdx)) {
+                    // Before the slice
+                    ++u64LineIdx;
+                }
+                else if (ptrChrEol > ptrChrAt) {
+                    if (sizTotalSamp <= sizSampleIdx) {
+                        if (bStopEarly) {
+                            // End of the slice
+                            bEof = true;
+                            break;
+                        }
+                        // More samples than configured
+                        return error::enmErrorFileSize;
+                    }
+                    if (sizSampleIdx > (u64SplitCount * (u64TotalSamp / 20))) {
+                        if (stcOpts.fcnProgress) {
+                            stcOpts.fcnProgress(sizSampleIdx, u64TotalSamp);
+                        }
+                        ++u64SplitCount;
+                    }
+
+                    error::enmErrorType const enmErrSample = parseAsciiSample(
+                        stcCfgIn,
+                        stcDatOut,
+                        sizSampleIdx,
+                        ptrChrAt,
+                        ptrChrEol,
+                        stcStatsOut.u64MissingTimestamps,
+                        u64MissingValues
+                    );
+                    if (error::enmErrorNone != enmErrSample) {
+                        return enmErrSample;
+                    }
+                    ++sizSampleIdx;
+                    ++stcStatsOut.u64SamplesParsed;
+                }
+
+                ptrChrAt = ptrChrNext;
+            }
+            u64NowNs = getTimeNs();
+            stcStatsOut.u64DecodeNs += (u64NowNs - u64TimeNs);
+            u64TimeNs = u64NowNs;
+
+            // Convert samples completed in this block
+            scaleAnalogStorage(stcCfgIn, stcDatOut, sizScaledIdx, sizSampleIdx);
+            if (0 != u64MissingValues) {
+                markMissingAsciiValues(stcCfgIn, stcDatOut, sizScaledIdx, sizSampleIdx);
+                u64MissingValues = 0;
+            }
+            sizScaledIdx = sizSampleIdx;
+            stcStatsOut.u64ConvertNs += (getTimeNs() - u64TimeNs);
+
+            // Carry partial line over to the next block
+            sizCarry = static_cast<size_t>(ptrChrEnd - ptrChrAt);
+            std::memmove(vctChrBuf.data(), ptrChrAt, sizCarry);
+        }
+
+        if (sizTotalSamp != sizSampleIdx) {
+            // Fewer samples than configured
+            return error::enmErrorFileSize;
+        }
+
+        u64TimeNs = getTimeNs();
+        indexChannelStorage(stcCfgIn, stcDatOut);
+        stcStatsOut.u64IndexNs += (getTimeNs() - u64TimeNs);
+
+        return error::enmErrorNone;
+    }
+
+    static mf::stcStrideTableType
+        getSampleTable(
+            stcDataFileType const& stcDat,
+            mf::clsMappedFile const& objMfDat
+        ) {
+        /* View the samples held by the record (or slice) as a fixed-stride table over the mapping */
+        size_t const sizStrideBytes = static_cast<size_t>(stcDat.u32SampleSizeBytes);
+        return mf::stcStrideTableType{
+            (objMfDat.data() + (static_cast<size_t>(stcDat.u64FirstSampleIdx) * sizStrideBytes)),
+            sizStrideBytes,
+            static_cast<size_t>(stcDat.u64TotalSamples)
+        };
+    }
+
+    static void
+        markMissingBinaryValues(
+            int32_t const i32MissingValue,
+            int32_t const* const ptrI32In,
+            size_t const sizCount,
+            float64_t* const ptrF64Out
+        ) {
+        /* Replace scaled values of a block whose raw value is the format's missing marker with NaN */
+        // (a select rather than a branch, so the loop vectorizes like the scaling before it)
+        float64_t const f64Nan = std::nan("");
+        for (size_t sizIdx = 0; sizCount > sizIdx; ++sizIdx) {
+            ptrF64Out[sizIdx] = (i32MissingValue == ptrI32In[sizIdx]) ? f64Nan : ptrF64Out[sizIdx];
+        }
+    }
+
+    // Analog field width and kernels of each binary format (the 2013 revision's BINARY32 and
+    // FLOAT32 only widen the analog fields to four bytes; the rest of the sample is unchanged)
+    template <enmDataFileFormatType enmFormat>
+    struct stcBinaryFormatType;
+
+    template <>
+    struct stcBinaryFormatType<enmDataFileFormatBinary> {
+        static constexpr size_t sizAnaValueBytes = 2;
+
+        static int32_t
+            load(
+                char const* const ptrChrIn
+            ) {
+            return decode::loadI16Le(ptrChrIn);
+        }
+
+        static void
+            gather(
+                char const* const ptrChrBase,
+                size_t const sizStrideBytes,
+                size_t const sizCount,
+                int32_t* const ptrI32Out
+            ) {
+            decode::gatherI16Le(ptrChrBase, sizStrideBytes, sizCount, ptrI32Out);
+        }
+
+        static void
+            scale(
+                int32_t const* const ptrI32In,
+                size_t const sizCount,
+                float64_t const f64Mult,
+                float64_t const f64Offset,
+                float64_t* const ptrF64Out
+            ) {
+            decode::scaleI32ToF64(ptrI32In, sizCount, f64Mult, f64Offset, ptrF64Out);
+            markMissingBinaryValues(i32MissingValueBinary, ptrI32In, sizCount, ptrF64Out);
+        }
+    };
+
+    template <>
+    struct stcBinaryFormatType<enmDataFileFormatBinary32> {
+        static constexpr size_t sizAnaValueBytes = 4;
+
+        static int32_t
+            load(
+                char const* const ptrChrIn
+            ) {
+            return decode::loadI32Le(ptrChrIn);
+        }
+
+        static void
+            gather(
+                char const* const ptrChrBase,
+                size_t const sizStrideBytes,
+                size_t const sizCount,
+                int32_t* const ptrI32Out
+            ) {
+            decode::gatherI32Le(ptrChrBase, sizStrideBytes, sizCount, ptrI32Out);
+        }
+
+        static void
+            scale(
+                int32_t const* const ptrI32In,
+                size_t const sizCount,
+                float64_t const f64Mult,
+                float64_t const f64Offset,
+                float64_t* const ptrF64Out
+            ) {
+            decode::scaleI32ToF64(ptrI32In, sizCount, f64Mult, f64Offset, ptrF64Out);
+            markMissingBinaryValues(i32MissingValueBinary32, ptrI32In, sizCount, ptrF64Out);
+        }
+    };
+
+    template <>
+    struct stcBinaryFormatType<enmDataFileFormatFloat32> {
+        static constexpr size_t sizAnaValueBytes = 4;
+
+        static int32_t
+            load(
+                char const* const ptrChrIn
+            ) {
+            return decode::loadI32Le(ptrChrIn);
+        }
+
+        // raw values keep the bits of the `float`
+        static void
+            gather(
+                char const* const ptrChrBase,
+                size_t const sizStrideBytes,
+                size_t const sizCount,
+                int32_t* const ptrI32Out
+            ) {
+            decode::gatherI32Le(ptrChrBase, sizStrideBytes, sizCount, ptrI32Out);
+        }
+
+        // (a NaN marker stays NaN through the scaling)
+        static void
+            scale(
+                int32_t const* const ptrI32In,
+                size_t const sizCount,
+                float64_t const f64Mult,
+                float64_t const f64Offset,
+                float64_t* const ptrF64Out
+            ) {
+            decode::scaleF32BitsToF64(ptrI32In, sizCount, f64Mult, f64Offset, ptrF64Out);
+        }
+    };
+
+    template <enmDataFileFormatType enmFormat>
+    static void
+        decodeBinaryAnalogChannel(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            mf::stcStrideTableType const& stcSampleTable,
+            size_t const sizChanIdx,
+            size_t const sizSampleBegin,
+            size_t const sizSampleEnd,
+            stcParseStatsType* const ptrStcStatsOut
+        ) {
+        /* Decode and scale one analog channel over a range of samples (timed if `ptrStcStatsOut` is set) */
+        stcAnalogScalingType const& stcAnaScaling = stcCfgIn.vctAnaScaling[sizChanIdx];
+        stcAnalogChannelDataType& stcAnaChanData = stcDatOut.vctAnaChanData[sizChanIdx];
+        int32_t* const ptrI32Raw = (stcAnaChanData.ptrI32DataRaw + sizSampleBegin);
+        float64_t* const ptrF64Data = (stcAnaChanData.ptrF64Data + sizSampleBegin);
+        size_t const sizCount = (sizSampleEnd - sizSampleBegin);
+
+        uint64_t const u64BeginNs = (nullptr != ptrStcStatsOut) ? getTimeNs() : 0;
+        stcBinaryFormatType<enmFormat>::gather(
+            (stcSampleTable.row(sizSampleBegin) + 4 + 4 + (stcBinaryFormatType<enmFormat>::sizAnaValueBytes * sizChanIdx)),
+            stcSampleTable.sizStrideBytes,
+            sizCount,
+            ptrI32Raw
+        );
+        uint64_t const u64GatheredNs = (nullptr != ptrStcStatsOut) ? getTimeNs() : 0;
+        stcBinaryFormatType<enmFormat>::scale(
+            ptrI32Raw,
+            sizCount,
+            stcAnaScaling.f64Mult,
+            stcAnaScaling.f64Offset,
+            ptrF64Data
+        );
+        if (nullptr != ptrStcStatsOut) {
+            ptrStcStatsOut->u64DecodeNs += (u64GatheredNs - u64BeginNs);
+            ptrStcStatsOut->u64ConvertNs += (getTimeNs() - u64GatheredNs);
+        }
+    }
+
+    static void
+        decodeBinaryStatusWord(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            mf::stcStrideTableType const& stcSampleTable,
+            size_t const sizWordIdx,
+            size_t const sizSampleBegin,
+            size_t const sizSampleEnd
+        ) {
+        /* Decode the (up to 16) digital channels of one status word over a range of samples */
+        //
+        // The range must begin on a 64-sample boundary. Channels `16 * sizWordIdx` onward are
+        // packed LSB first into this word. The status words close each sample in every binary
+        // format, so they are located from the end of the sample.
+        size_t const sizNumDigChan = static_cast<size_t>(stcCfgIn.u32NumDigChannels);
+        size_t const sizNumDigWords = ((sizNumDigChan + 15) / 16);
+        size_t const sizFirstChan = (16 * sizWordIdx);
+        size_t const sizNumBits = std::min(static_cast<size_t>(16), (sizNumDigChan - sizFirstChan));
+        uint64_t* arrPtrU64DigBits[16] = {};
+        for (size_t sizBit = 0; sizNumBits > sizBit; ++sizBit) {
+            arrPtrU64DigBits[sizBit] = (
+                stcDatOut.vctDigChanData[sizFirstChan + sizBit].ptrU64Bits
+                + (sizSampleBegin / 64)
+                );
+        }
+
+        decode::gatherBitsU16Le(
+            (stcSampleTable.row(sizSampleBegin) + stcSampleTable.sizStrideBytes - (2 * sizNumDigWords) + (2 * sizWordIdx)),
+            stcSampleTable.sizStrideBytes,
+            (sizSampleEnd - sizSampleBegin),
+            sizNumBits,
+            arrPtrU64DigBits
+        );
+    }
+
+    // Analog channels unpacked per pass over a block of samples by the fixed layout decoders
+    // (more output streams than this fall out of the store buffers and cache)
+    static constexpr size_t sizRowGroupChannels = 32;
+
+    template <enmDataFileFormatType enmFormat, size_t sizFirstChan, size_t... sizChanIdx>
+    static void
+        gatherBinaryAnalogRow(
+            char const* const ptrChrAnalog,
+            int32_t* const* const arrPtrI32Raw,
+            size_t const sizSampleIdx,
+            std::index_sequence<sizChanIdx...>
+        ) {
+        /* Unpack a group of analog fields of one sample (one statement per channel, no loop) */
+        ((arrPtrI32Raw[sizFirstChan + sizChanIdx][sizSampleIdx] = stcBinaryFormatType<enmFormat>::load(
+            ptrChrAnalog + (stcBinaryFormatType<enmFormat>::sizAnaValueBytes * (sizFirstChan + sizChanIdx))
+        )), ...);
+    }
+
+    template <enmDataFileFormatType enmFormat, size_t sizFirstChan, size_t sizNumAnaChan>
+    static void
+        gatherBinaryAnalogRowGroups(
+            mf::stcStrideTableType const& stcSampleTable,
+            int32_t* const* const arrPtrI32Raw,
+            size_t const sizSampleBegin,
+            size_t const sizSampleEnd
+        ) {
+        /* Unpack analog channels `sizFirstChan` onward, one group per pass over the samples */
+        if constexpr (sizNumAnaChan > sizFirstChan) {
+            constexpr size_t sizNumGroupChan = std::min(sizRowGroupChannels, (sizNumAnaChan - sizFirstChan));
+            for (size_t sizIter = sizSampleBegin; sizSampleEnd > sizIter; ++sizIter) {
+                gatherBinaryAnalogRow<enmFormat, sizFirstChan>(
+                    (stcSampleTable.row(sizIter) + 4 + 4),
+                    arrPtrI32Raw,
+                    sizIter,
+                    std::make_index_sequence<sizNumGroupChan>{}
+                );
+            }
+            gatherBinaryAnalogRowGroups<enmFormat, (sizFirstChan + sizNumGroupChan), sizNumAnaChan>(
+                stcSampleTable,
+                arrPtrI32Raw,
+                sizSampleBegin,
+                sizSampleEnd
+            );
+        }
+    }
+
+    // `sizNumAnaChanFixed` is the analog channel count of a common layout, for which the analog
+    // fields are unpacked together with the sample number and timestamp, one whole sample at a
+    // time (fully unrolled); 0 is the generic decoder, which unpacks one channel at a time
+    template <enmDataFileFormatType enmFormat, size_t sizNumAnaChanFixed>
+    static error::enmErrorType
+        decodeBinarySamples(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            mf::stcStrideTableType const& stcSampleTable,
+            size_t const sizSampleBegin,
+            size_t const sizSampleEnd,
+            bool const bDecodeChannels,
+            uint32_t& u32FirstSampleNumberOut,
+            uint32_t& u32LastSampleNumberOut,
+            stcParseStatsType* const ptrStcStatsOut
+        ) {
+        /* Decode a range of samples in place, one cache-sized block at a time */
+        //
+        // Only writes the given range of the (pre-allocated) storage, so disjoint ranges may be
+        // decoded concurrently as long as each range begins on a 64-sample boundary (digital
+        // bitsets pack 64 samples per word). Sample numbers are only checked for continuity within
+        // the range; the caller checks the boundaries between ranges. Channel data is skipped
+        // (left for on-demand decoding) unless `bDecodeChannels` is set. Statistics are only
+        // gathered (into per-range counters) if `ptrStcStatsOut` is set.
+        constexpr bool bFixedLayout = (0 != sizNumAnaChanFixed);
+        size_t const sizNumAnaChan = bFixedLayout ? sizNumAnaChanFixed : static_cast<size_t>(stcCfgIn.u32NumAnaChannels);
+        size_t const sizNumDigChan = static_cast<size_t>(stcCfgIn.u32NumDigChannels);
+        size_t const sizNumDigWords = ((sizNumDigChan + 15) / 16);
+        size_t const sizBlockSamples = 4096;
+
+        int32_t* arrPtrI32Raw[bFixedLayout ? sizNumAnaChanFixed : 1] = {};
+        if constexpr (bFixedLayout) {
+            for (size_t sizIterJ = 0; sizNumAnaChan > sizIterJ; ++sizIterJ) {
+                arrPtrI32Raw[sizIterJ] = stcDatOut.vctAnaChanData[sizIterJ].ptrI32DataRaw;
+            }
+        }
+
+        uint32_t u32PrevSampleNumber = 0;
+        uint64_t u64MissingTimestamps = 0;
+
+        for (size_t sizBlockBegin = sizSampleBegin; sizSampleEnd > sizBlockBegin; sizBlockBegin += sizBlockSamples) {
+            size_t const sizBlockEnd = std::min(sizSampleEnd, (sizBlockBegin + sizBlockSamples));
+            uint64_t const u64BlockBeginNs = (nullptr != ptrStcStatsOut) ? getTimeNs() : 0;
+
+            for (size_t sizIter = sizBlockBegin; sizBlockEnd > sizIter; ++sizIter) {
+                char const* const ptrChrRow = stcSampleTable.row(sizIter);
+                stcSampleDataType& stcSampleData = stcDatOut.vctSampleData[sizIter];
+
+                // Parse sample count
+                stcSampleData.u32SampleNumber = decode::loadU32Le(ptrChrRow);
+                stcSampleData.u32RowIdx = static_cast<uint32_t>(sizIter);
+
+                // Validate sample count
+                if (sizSampleBegin == sizIter) {
+                    u32FirstSampleNumberOut = stcSampleData.u32SampleNumber;
+                }
+                else if ((1 + u32PrevSampleNumber) != stcSampleData.u32SampleNumber) {
+                    return error::emErrorOutOfOrder;
+                }
+                u32PrevSampleNumber = stcSampleData.u32SampleNumber;
+
+                // Parse timestamp (0xFFFFFFFF --> missing, NaN as for a blank ASCII timestamp)
+                uint32_t const u32Timestamp = decode::loadU32Le(ptrChrRow + 4);
+                bool const bMissingTimestamp = (0xFFFFFFFF == u32Timestamp);
+                stcSampleData.f64TimestampUs = bMissingTimestamp
+                    ? std::nan("")
+                    : (stcCfgIn.f64TimeMult * u32Timestamp);
+                u64MissingTimestamps += (bMissingTimestamp ? 1 : 0);
+
+                // Parse analog channel sample data (fixed layout: the first group of channels)
+                if constexpr (bFixedLayout) {
+                    if (bDecodeChannels) {
+                        gatherBinaryAnalogRow<enmFormat, 0>(
+                            (ptrChrRow + 4 + 4),
+                            arrPtrI32Raw,
+                            sizIter,
+                            std::make_index_sequence<std::min(sizRowGroupChannels, sizNumAnaChanFixed)>{}
+                        );
+                    }
+                }
+            }
+            if (nullptr != ptrStcStatsOut) {
+                ptrStcStatsOut->u64DecodeNs += (getTimeNs() - u64BlockBeginNs);
+            }
+
+            if (!bDecodeChannels) {
+                continue;
+            }
+
+            if constexpr (bFixedLayout) {
+                // Unpack the other groups of channels, then scale the block (per channel)
+                uint64_t const u64GroupsBeginNs = (nullptr != ptrStcStatsOut) ? getTimeNs() : 0;
+                gatherBinaryAnalogRowGroups<enmFormat, sizRowGroupChannels, sizNumAnaChanFixed>(
+                    stcSampleTable,
+                    arrPtrI32Raw,
+                    sizBlockBegin,
+                    sizBlockEnd
+                );
+                uint64_t const u64ScaleBeginNs = (nullptr != ptrStcStatsOut) ? getTimeNs() : 0;
+                if (nullptr != ptrStcStatsOut) {
+                    ptrStcStatsOut->u64DecodeNs += (u64ScaleBeginNs - u64GroupsBeginNs);
+                }
+                for (size_t sizIterJ = 0; sizNumAnaChan > sizIterJ; ++sizIterJ) {
+                    stcAnalogScalingType const& stcAnaScaling = stcCfgIn.vctAnaScaling[sizIterJ];
+                    stcAnalogChannelDataType& stcAnaChanData = stcDatOut.vctAnaChanData[sizIterJ];
+                    stcBinaryFormatType<enmFormat>::scale(
+                        (stcAnaChanData.ptrI32DataRaw + sizBlockBegin),
+                        (sizBlockEnd - sizBlockBegin),
+                        stcAnaScaling.f64Mult,
+                        stcAnaScaling.f64Offset,
+                        (stcAnaChanData.ptrF64Data + sizBlockBegin)
+                    );
+                }
+                if (nullptr != ptrStcStatsOut) {
+                    ptrStcStatsOut->u64ConvertNs += (getTimeNs() - u64ScaleBeginNs);
+                }
+            }
+            else {
+                // Parse analog channel sample data (whole block per channel)
+                for (size_t sizIterJ = 0; sizNumAnaChan > sizIterJ; ++sizIterJ) {
+                    decodeBinaryAnalogChannel<enmFormat>(stcCfgIn, stcDatOut, stcSampleTable, sizIterJ, sizBlockBegin, sizBlockEnd, ptrStcStatsOut);
+                }
+            }
+
+            // Parse digital channel sample data (whole block per status word)
+            uint64_t const u64DigBeginNs = (nullptr != ptrStcStatsOut) ? getTimeNs() : 0;
+            for (size_t sizWordIdx = 0; sizNumDigWords > sizWordIdx; ++sizWordIdx) {
+                decodeBinaryStatusWord(stcCfgIn, stcDatOut, stcSampleTable, sizWordIdx, sizBlockBegin, sizBlockEnd);
+            }
+            if (nullptr != ptrStcStatsOut) {
+                ptrStcStatsOut->u64DecodeNs += (getTimeNs() - u64DigBeginNs);
+            }
+        }
+
+        if (nullptr != ptrStcStatsOut) {
+            ptrStcStatsOut->u64SamplesParsed += (sizSampleEnd - sizSampleBegin);
+            ptrStcStatsOut->u64MissingTimestamps += u64MissingTimestamps;
+        }
+        u32LastSampleNumberOut = u32PrevSampleNumber;
+        return error::enmErrorNone;
+    }
+
+    // Decoders specialized for one binary format and sample layout (chosen once per parse or channel)
+    struct stcBinaryDecoderType {
+        decltype(&decodeBinarySamples<enmDataFileFormatBinary, 0>) fcnDecodeSamples;
+        decltype(&decodeBinaryAnalogChannel<enmDataFileFormatBinary>) fcnDecodeAnalogChannel;
+    };
+
+    template <enmDataFileFormatType enmFormat, size_t sizNumAnaChanFixed>
+    static constexpr stcBinaryDecoderType objBinaryDecoder{
+        &decodeBinarySamples<enmFormat, sizNumAnaChanFixed>,
+        &decodeBinaryAnalogChannel<enmFormat>
+    };
+
+    template <enmDataFileFormatType enmFormat>
+    static stcBinaryDecoderType const&
+        getBinaryLayoutDecoder(
+            uint32_t const u32NumAnaChannels
+        ) {
+        // Analog channel counts of common recorder layouts get a fully unrolled decoder
+        switch (u32NumAnaChannels) {
+        case 8: {
+            return objBinaryDecoder<enmFormat, 8>;
+        }
+        case 16: {
+            return objBinaryDecoder<enmFormat, 16>;
+        }
+        case 24: {
+            return objBinaryDecoder<enmFormat, 24>;
+        }
+        case 32: {
+            return objBinaryDecoder<enmFormat, 32>;
+        }
+        case 48: {
+            return objBinaryDecoder<enmFormat, 48>;
+        }
+        case 64: {
+            return objBinaryDecoder<enmFormat, 64>;
+        }
+        case 96: {
+            return objBinaryDecoder<enmFormat, 96>;
+        }
+        default: {
+            return objBinaryDecoder<enmFormat, 0>;
+        }
+        }
+    }
+
+    static stcBinaryDecoderType const&
+        getBinaryDecoder(
+            stcConfigFileType const& stcCfg
+        ) {
+        switch (stcCfg.enmDataFileFormat) {
+        case enmDataFileFormatBinary32: {
+            return getBinaryLayoutDecoder<enmDataFileFormatBinary32>(stcCfg.u32NumAnaChannels);
+        }
+        case enmDataFileFormatFloat32: {
+            return getBinaryLayoutDecoder<enmDataFileFormatFloat32>(stcCfg.u32NumAnaChannels);
+        }
+        default: {
+            return getBinaryLayoutDecoder<enmDataFileFormatBinary>(stcCfg.u32NumAnaChannels);
+        }
+        }
+    }
+
+    static error::enmErrorType
+        parseBinaryDataFile(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            mf::clsMappedFile const& objMfDat,
+            stcParseOptionsType const& stcOpts,
+            stcParseStatsType& stcStatsOut
+        ) {
+        /* 6.5 Binary data files */
+        //
+        // Notes
+        //     - marshalling (little endian)
+        //         - "the standard DOS format is to store the least significant byte (LSB) of the
+        //           data first"
+        //     - sample size
+        //         - "the number of bytes required for each sample in the file will be:
+        //             - (Ak * 2) + (2 * INT(Dm/16)) + 4 + 4"
+        //         - "INT(Dm/16) is the number of status channels divided by 16 and rounded up to
+        //           the next integer"
+        //         - BINARY32 and FLOAT32 (2013 revision) use (Ak * 4) for the analog channels
+        // 
+        // Sequence
+        //     - sample number (uint32_t)
+        //         - "unsigned binary form of four bytes"
+        //     - timestamp (uint32_t)
+        //         - "unsigned binary form of four bytes"
+        //         - "hexadecimal 8000 is reserved to mark missing data"
+        //     - analog channel sample data (int16_t, or int32_t / float for BINARY32 / FLOAT32)
+        //         - "two's complement binary format of two bytes each"
+        //     - status [digital] channel sample data (uint16_t, bitfield)
+        //         - "stored in groups of two bytes for each 16 status channels, with the least
+        //           significant bit of a word assigned to the smallest input channel number
+        //           belonging to that group of 16 channels"
+
+        /* Calculate sample size */
+        stcDatOut.u32SampleSizeBytes = getBinarySampleSizeBytes(stcCfgIn);
+        stcBinaryDecoderType const& stcDecoder = getBinaryDecoder(stcCfgIn);
+
+        uint64_t u64TimeNs = getTimeNs();
+        allocateChannelStorage(stcCfgIn, stcDatOut, !stcOpts.bLazy);
+        stcStatsOut.u64IndexNs += (getTimeNs() - u64TimeNs);
+
+        uint64_t const u64TotalSamp = stcDatOut.u64TotalSamples;
+        size_t const sizTotalSamp = static_cast<size_t>(u64TotalSamp);
+
+        /* Validate data file size (whole record, even when only a slice is decoded) */
+        uint64_t const u64RequiredBytes = (stcCfgIn.u64TotalSamples * stcDatOut.u32SampleSizeBytes);
+        if (objMfDat.size() < u64RequiredBytes) {
+            return error::enmErrorFileSize;
+        }
+
+        /* View the mapped file as a fixed-stride table of samples */
+        mf::stcStrideTableType const stcSampleTable = getSampleTable(stcDatOut, objMfDat);
+
+        /* Split samples into chunks (located by offset arithmetic alone) */
+        size_t const sizNumThreads = tp::resolveNumThreads(stcOpts.u32NumThreads);
+        size_t const sizMinChunkSamples = 16384;
+        size_t const sizNumChunks = (1 == sizNumThreads)
+            // serial: one chunk per progress step
+            ? 20
+            // parallel: a few chunks per thread to balance load
+            : std::max(
+                static_cast<size_t>(1),
+                std::min((4 * sizNumThreads), (sizTotalSamp / sizMinChunkSamples))
+            );
+        // Chunks begin on 64-sample boundaries so no digital bitset word is shared
+        size_t const sizChunkSamples = (64 * ((((sizTotalSamp + sizNumChunks - 1) / sizNumChunks) + 63) / 64));
+
+        std::vector<error::enmErrorType> vctEnmChunkErr(sizNumChunks, error::enmErrorNone);
+        std::vector<uint32_t> vctU32ChunkFirst(sizNumChunks, 0);
+        std::vector<uint32_t> vctU32ChunkLast(sizNumChunks, 0);
+        // per-chunk statistics (only gathered when requested, since timing every block costs)
+        bool const bGatherStats = (nullptr != stcOpts.ptrStcStats);
+        std::vector<stcParseStatsType> vctStcChunkStats(bGatherStats ? sizNumChunks : 0, stcParseStatsType{});
+        std::mutex objMtxProgress;
+        uint64_t u64SamplesDone = 0;
+
+        auto const fcnDecodeChunk = [&](size_t const sizChunkIdx) {
+            size_t const sizBegin = std::min(sizTotalSamp, (sizChunkIdx * sizChunkSamples));
+            size_t const sizEnd = std::min(sizTotalSamp, (sizBegin + sizChunkSamples));
+            if (sizBegin < sizEnd) {
+                vctEnmChunkErr[sizChunkIdx] = stcDecoder.fcnDecodeSamples(
+                    stcCfgIn,
+                    stcDatOut,
+                    stcSampleTable,
+                    sizBegin,
+                    sizEnd,
+                    !stcOpts.bLazy,
+                    vctU32ChunkFirst[sizChunkIdx],
+                    vctU32ChunkLast[sizChunkIdx],
+                    (bGatherStats ? &vctStcChunkStats[sizChunkIdx] : nullptr)
+                );
+            }
+            if (stcOpts.fcnProgress) {
+                std::lock_guard<std::mutex> objLock(objMtxProgress);
+                u64SamplesDone += (sizEnd - sizBegin);
+                stcOpts.fcnProgress(u64SamplesDone, u64TotalSamp);
+            }
+        };
+
+        if (1 == sizNumThreads) {
+            for (size_t sizChunkIdx = 0; sizNumChunks > sizChunkIdx; ++sizChunkIdx) {
+                fcnDecodeChunk(sizChunkIdx);
+            }
+        }
+        else {
+            tp::clsThreadPool::getShared().parallelFor(
+                sizNumChunks,
+                sizNumThreads,
+                fcnDecodeChunk
+            );
+        }
+
+        /* Validate sample count continuity across chunk boundaries */
+        stcDatOut.u32PrevSampleNumber = static_cast<uint32_t>(stcDatOut.u64FirstSampleIdx);
+        for (size_t sizChunkIdx = 0; sizNumChunks > sizChunkIdx; ++sizChunkIdx) {
+            if (error::enmErrorNone != vctEnmChunkErr[sizChunkIdx]) {
+                return vctEnmChunkErr[sizChunkIdx];
+            }
+            size_t const sizBegin = std::min(sizTotalSamp, (sizChunkIdx * sizChunkSamples));
+            if (sizTotalSamp == sizBegin) {
+                // Empty trailing chunk
+                break;
+            }
+            if ((1 + stcDatOut.u32PrevSampleNumber) != vctU32ChunkFirst[sizChunkIdx]) {
+                return error::emErrorOutOfOrder;
+            }
+            stcDatOut.u32PrevSampleNumber = vctU32ChunkLast[sizChunkIdx];
+        }
+
+        for (stcParseStatsType const& stcChunkStats : vctStcChunkStats) {
+            stcStatsOut.u64SamplesParsed += stcChunkStats.u64SamplesParsed;
+            stcStatsOut.u64MissingTimestamps += stcChunkStats.u64MissingTimestamps;
+            stcStatsOut.u64DecodeNs += stcChunkStats.u64DecodeNs;
+            stcStatsOut.u64ConvertNs += stcChunkStats.u64ConvertNs;
+        }
+        stcStatsOut.u64BytesRead += (u64TotalSamp * stcDatOut.u32SampleSizeBytes);
+
+        u64TimeNs = getTimeNs();
+        indexChannelStorage(stcCfgIn, stcDatOut);
+        stcStatsOut.u64IndexNs += (getTimeNs() - u64TimeNs);
+
+        return error::enmErrorNone;
+    }
+
+    error::enmErrorType
+        parseDataFile(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut
+        ) {
+        return parseDataFile(
+            stcCfgIn,
+            stcDatOut,
+            stcParseOptionsType{}
+        );
+    }
+
+    error::enmErrorType
+        parseDataFile(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            stcParseOptionsType const& stcOpts
+        ) {
+        return parseDataFileRange(
+            stcCfgIn,
+            stcDatOut,
+            0,
+            stcCfgIn.u64TotalSamples,
+            stcOpts
+        );
+    }
+
+    error::enmErrorType
+        parseDataFileWindow(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            float64_t const f64BeginUs,
+            float64_t const f64EndUs,
+            stcParseOptionsType const& stcOpts
+        ) {
+        if (!stcCfgIn.bInit) {
+            return error::enmErrorInvalidArg;
+        }
+        if (!(f64BeginUs <= f64EndUs)) {
+            return error::enmErrorInvalidArg;
+        }
+        if (!stcCfgIn.bFixedRate) {
+            return error::enmErrorNotImpl;
+        }
+
+        // Convert the trigger-relative window into time relative to the first sample of the record
+        float64_t const f64TriggerUs = getTriggerOffsetUs(stcCfgIn);
+        uint64_t u64BeginIdx = 0;
+        uint64_t u64EndIdx = 0;
+        error::enmErrorType enmErrRet = getSampleIndexAtTime(stcCfgIn, (f64TriggerUs + f64BeginUs), u64BeginIdx);
+        if (error::enmErrorNone != enmErrRet) {
+            return enmErrRet;
+        }
+        enmErrRet = getSampleIndexAtTime(stcCfgIn, (f64TriggerUs + f64EndUs), u64EndIdx);
+        if (error::enmErrorNone != enmErrRet) {
+            return enmErrRet;
+        }
+
+        return parseDataFileRange(
+            stcCfgIn,
+            stcDatOut,
+            u64BeginIdx,
+            (u64EndIdx - u64BeginIdx),
+            stcOpts
+        );
+    }
+
+    error::enmErrorType
+        parseDataFileRange(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            uint64_t const u64FirstSampleIdx,
+            uint64_t const u64NumSamples,
+            stcParseOptionsType const& stcOpts
+        ) {
+        if (!stcCfgIn.bInit) {
+            return error::enmErrorInvalidArg;
+        }
+        if (
+            (u64FirstSampleIdx > stcCfgIn.u64TotalSamples)
+            || (u64NumSamples > (stcCfgIn.u64TotalSamples - u64FirstSampleIdx))
+            ) {
+            return error::enmErrorInvalidArg;
+        }
+
+        /* Un-initialize configuration data */
+        stcDatOut.bInit = false;
+        stcDatOut.bLazy = false;
+        stcDatOut.objMfDat.close();
+
+        /* Variables for parsing */
+        error::enmErrorType enmErrRet = error::enmErrorNone;
+        error::enmErrorType enmErrOpen = error::enmErrorNone;
+        std::ifstream objIfsDat;
+        mf::clsMappedFile objMfDat;
+        stcParseStatsType stcStats{};
+        uint64_t const u64BeginNs = getTimeNs();
+        uint64_t u64CloseNs = 0;
+        // storage already held by a reused record (growth beyond it counts as allocations)
+        uint64_t const u64ArenaAllocations = stcDatOut.objArena.allocations();
+        size_t const sizSampleCapacity = stcDatOut.vctSampleData.capacity();
+        size_t const sizAnaChanCapacity = stcDatOut.vctAnaChanData.capacity();
+        size_t const sizDigChanCapacity = stcDatOut.vctDigChanData.capacity();
+        // a single sampling rate means every sample follows its predecessor by the same period
+        stcDatOut.bSimpleSampling = (1 == stcCfgIn.vctSamplingRateInfo.size());
+        // total sample quantity matches last sample number of the last sampling rate (whole record)
+        stcDatOut.u64FirstSampleIdx = u64FirstSampleIdx;
+        stcDatOut.u64TotalSamples = u64NumSamples;
+
+        switch (stcCfgIn.enmDataFileFormat) {
+        case comtrade::enmDataFileFormatAscii: {
+            // Open data file as a stream
+            enmErrOpen = utils::openFile(
+                stcCfgIn.strDatFileName,
+                (std::ifstream::binary | std::ifstream::in),
+                objIfsDat
+            );
+            stcStats.u64IoNs += (getTimeNs() - u64BeginNs);
+            if (error::enmErrorNone != enmErrOpen) {
+                enmErrRet = enmErrOpen;
+                goto cleanup;
+            }
+            enmErrRet = parseAsciiDataFile(stcCfgIn, stcDatOut, objIfsDat, stcOpts, stcStats);
+            break;
+        }
+        case comtrade::enmDataFileFormatBinary:
+        case comtrade::enmDataFileFormatBinary32:
+        case comtrade::enmDataFileFormatFloat32: {
+            // Map data file so samples are decoded straight from the page cache
+            enmErrOpen = utils::openFile(
+                stcCfgIn.strDatFileName,
+                objMfDat
+            );
+            stcStats.u64IoNs += (getTimeNs() - u64BeginNs);
+            if (error::enmErrorNone != enmErrOpen) {
+                enmErrRet = enmErrOpen;
+                goto cleanup;
+            }
+            enmErrRet = parseBinaryDataFile(stcCfgIn, stcDatOut, objMfDat, stcOpts, stcStats);
+            if ((error::enmErrorNone == enmErrRet) && stcOpts.bLazy) {
+                // Keep the mapping alive for on-demand channel decoding
+                stcDatOut.objMfDat = std::move(objMfDat);
+                stcDatOut.bLazy = true;
+            }
+            break;
+        }
+        default: {
+            enmErrRet = error::enmErrorInvalidArg;
+            goto cleanup;
+            break;
+        }
+        }
+        if (error::enmErrorNone != enmErrRet) {
+            goto cleanup;
+        }
+
+        /* Mark initialized */
+        stcDatOut.bInit = true;
+        if (stcOpts.fcnProgress) {
+            stcOpts.fcnProgress(stcDatOut.u64TotalSamples, stcDatOut.u64TotalSamples);
+        }
+
+    cleanup:
+        if (error::enmErrorNone == enmErrRet) {
+            DIAG_LOG(
+                diag::enmLevelInfo,
+                ("Parsed data file " + stcCfgIn.strDatFileName + " (" + std::to_string(stcDatOut.u64TotalSamples) + " samples)")
+            );
+        }
+        else {
+            DIAG_LOG(
+                diag::enmLevelWarning,
+                ("Cannot parse data file " + stcCfgIn.strDatFileName + ": " + error::getMessage(enmErrRet))
+            );
+        }
+        u64CloseNs = getTimeNs();
+        objIfsDat.close();
+        objMfDat.close();
+        if (nullptr != stcOpts.ptrStcStats) {
+            uint64_t const u64EndNs = getTimeNs();
+            stcStats.u64IoNs += (u64EndNs - u64CloseNs);
+            stcStats.u64Allocations += (
+                (stcDatOut.objArena.allocations() - u64ArenaAllocations)
+                + ((stcDatOut.vctSampleData.capacity() != sizSampleCapacity) ? 1 : 0)
+                + ((stcDatOut.vctAnaChanData.capacity() != sizAnaChanCapacity) ? 1 : 0)
+                + ((stcDatOut.vctDigChanData.capacity() != sizDigChanCapacity) ? 1 : 0)
+                );
+            stcStats.u64TotalNs = (u64EndNs - u64BeginNs);
+            stcStats.f64SamplesPerSec = (0 == stcStats.u64TotalNs)
+                ? 0.0
+                : ((1.0e+09 * static_cast<float64_t>(stcStats.u64SamplesParsed)) / static_cast<float64_t>(stcStats.u64TotalNs));
+            *stcOpts.ptrStcStats = stcStats;
+        }
+        return enmErrRet;
+    }
+
+    static size_t
+        readFileBytes(
+            std::ifstream& objIfsDat,
+            size_t const sizMaxBytes,
+            std::vector<char>& vctChrBufInOut
+        ) {
+        /* Append up to `sizMaxBytes` bytes from the current position of a stream to a buffer */
+        size_t const sizPrevBytes = vctChrBufInOut.size();
+        vctChrBufInOut.resize(sizPrevBytes + sizMaxBytes);
+        objIfsDat.read((vctChrBufInOut.data() + sizPrevBytes), static_cast<std::streamsize>(sizMaxBytes));
+        size_t const sizRead = static_cast<size_t>(objIfsDat.gcount());
+        vctChrBufInOut.resize(sizPrevBytes + sizRead);
+        return sizRead;
+    }
+
+    static error::enmErrorType
+        decodeBufferedAsciiSamples(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            char const* const ptrChrData,
+            size_t const sizDataBytes,
+            size_t const sizMaxLines,
+            bool const bEndOfData,
+            size_t& sizConsumedOut
+        ) {
+        /* Decode up to `sizMaxLines` complete lines of a buffer */
+        //
+        // An incomplete line at the end is left over, unless no more data is expected and it holds
+        // the last sample of the record (a final line without line ending).
+
+        stcDatOut.u32SampleSizeBytes = 0;
+        if (0 == sizDataBytes) {
+            // Nothing buffered (`ptrChrData` may then be null)
+            stcDatOut.u64TotalSamples = 0;
+            allocateChannelStorage(stcCfgIn, stcDatOut, true);
+            sizConsumedOut = 0;
+            return error::enmErrorNone;
+        }
+
+        char const* const ptrChrEnd = (ptrChrData + sizDataBytes);
+        char const* ptrChrLinesEnd = ptrChrData;
+        size_t sizNumLines = 0;
+        while (sizMaxLines > sizNumLines) {
+            char const* const ptrChrEol = static_cast<char const*>(
+                std::memchr(ptrChrLinesEnd, '\n', static_cast<size_t>(ptrChrEnd - ptrChrLinesEnd))
+                );
+            if (nullptr == ptrChrEol) {
+                break;
+            }
+            ptrChrLinesEnd = (ptrChrEol + 1);
+            ++sizNumLines;
+        }
+        bool const bFinalLine = (bEndOfData && (sizMaxLines > sizNumLines) && (ptrChrLinesEnd != ptrChrEnd));
+
+        // Every line is at most one sample
+        stcDatOut.u64TotalSamples = static_cast<uint64_t>(sizNumLines + (bFinalLine ? 1 : 0));
+        allocateChannelStorage(stcCfgIn, stcDatOut, true);
+
+        uint64_t u64MissingTimestamps = 0;
+        uint64_t u64MissingValues = 0;
+        size_t sizSampleIdx = 0;
+        char const* ptrChrAt = ptrChrData;
+        char const* const ptrChrStop = (bFinalLine ? ptrChrEnd : ptrChrLinesEnd);
+        while (ptrChrStop > ptrChrAt) {
+            char const* ptrChrEol = static_cast<char const*>(
+                std::memchr(ptrChrAt, '\n', static_cast<size_t>(ptrChrStop - ptrChrAt))
+                );
+            if (nullptr == ptrChrEol) {
+                ptrChrEol = ptrChrStop;
+            }
+            char const* const ptrChrNext = (ptrChrStop == ptrChrEol) ? ptrChrStop : (ptrChrEol + 1);
+            ptrChrEol = trimAsciiLine(ptrChrAt, ptrChrEol);
+
+            if (ptrChrEol > ptrChrAt) {
+                if (
+                    bFinalLine
+                    && (ptrChrLinesEnd <= ptrChrAt)
+                    && ((stcDatOut.u64FirstSampleIdx + sizSampleIdx + 1) != stcCfgIn.u64TotalSamples)
+                    ) {
+                    // Not the last sample after all (e.g., still being written)
+                    break;
+                }
+                error::enmErrorType const enmErrSample = parseAsciiSample(
+                    stcCfgIn,
+                    stcDatOut,
+                    sizSampleIdx,
+                    ptrChrAt,
+                    ptrChrEol,
+                    u64MissingTimestamps,
+                    u64MissingValues
+                );
+                if (error::enmErrorNone != enmErrSample) {
+                    return enmErrSample;
+                }
+                ++sizSampleIdx;
+            }
+            ptrChrAt = ptrChrNext;
+        }
+
+        // Blank lines leave storage unused at the end
+        stcDatOut.u64TotalSamples = static_cast<uint64_t>(sizSampleIdx);
+        stcDatOut.vctSampleData.resize(sizSampleIdx);
+        scaleAnalogStorage(stcCfgIn, stcDatOut, 0, sizSampleIdx);
+        if (0 != u64MissingValues) {
+            markMissingAsciiValues(stcCfgIn, stcDatOut, 0, sizSampleIdx);
+        }
+        sizConsumedOut = static_cast<size_t>(ptrChrAt - ptrChrData);
+
+        return error::enmErrorNone;
+    }
+
+    static error::enmErrorType
+        decodeBufferedBinarySamples(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            char const* const ptrChrData,
+            size_t const sizDataBytes,
+            size_t const sizMaxSamples,
+            size_t& sizConsumedOut
+        ) {
+        /* Decode up to `sizMaxSamples` complete samples of a buffer (an incomplete one is left over) */
+
+        stcDatOut.u32SampleSizeBytes = getBinarySampleSizeBytes(stcCfgIn);
+        size_t const sizStrideBytes = static_cast<size_t>(stcDatOut.u32SampleSizeBytes);
+        size_t const sizNumSamples = std::min((sizDataBytes / sizStrideBytes), sizMaxSamples);
+        stcDatOut.u64TotalSamples = static_cast<uint64_t>(sizNumSamples);
+        allocateChannelStorage(stcCfgIn, stcDatOut, true);
+
+        if (0 != sizNumSamples) {
+            mf::stcStrideTableType const stcSampleTable{ ptrChrData, sizStrideBytes, sizNumSamples };
+            uint32_t u32FirstSampleNumber = 0;
+            uint32_t u32LastSampleNumber = 0;
+            error::enmErrorType const enmErrDecode = getBinaryDecoder(stcCfgIn).fcnDecodeSamples(
+                stcCfgIn,
+                stcDatOut,
+                stcSampleTable,
+                0,
+                sizNumSamples,
+                true,
+                u32FirstSampleNumber,
+                u32LastSampleNumber,
+                nullptr
+            );
+            if (error::enmErrorNone != enmErrDecode) {
+                return enmErrDecode;
+            }
+            // Continue from the last sample of the previous poll
+            if ((1 + stcDatOut.u32PrevSampleNumber) != u32FirstSampleNumber) {
+                return error::emErrorOutOfOrder;
+            }
+            stcDatOut.u32PrevSampleNumber = u32LastSampleNumber;
+        }
+        sizConsumedOut = (sizNumSamples * sizStrideBytes);
+
+        return error::enmErrorNone;
+    }
+
+    error::enmErrorType
+        clsDataFileTail::open(
+            stcConfigFileType const& stcCfg
+        ) {
+        close();
+        if (!stcCfg.bInit) {
+            return error::enmErrorInvalidArg;
+        }
+        error::enmErrorType const enmErrOpen = utils::openFile(
+            stcCfg.strDatFileName,
+            (std::ifstream::binary | std::ifstream::in),
+            objIfsDat
+        );
+        if (error::enmErrorNone != enmErrOpen) {
+            return enmErrOpen;
+        }
+        ptrStcCfg = &stcCfg;
+        return error::enmErrorNone;
+    }
+
+    void
+        clsDataFileTail::close(
+            void
+        ) {
+        ptrStcCfg = nullptr;
+        objIfsDat.close();
+        objIfsDat.clear();
+        u64FileOffsetBytes = 0;
+        u64SamplesRead = 0;
+        u32PrevSampleNumber = 0;
+        vctChrPending.clear();
+    }
+
+    error::enmErrorType
+        clsDataFileTail::poll(
+            stcDataFileType& stcDatOut
+        ) {
+        if (!isOpen()) {
+            return error::enmErrorInvalidArg;
+        }
+        stcConfigFileType const& stcCfgIn = *ptrStcCfg;
+
+        /* Un-initialize configuration data */
+        stcDatOut.bInit = false;
+        stcDatOut.bLazy = false;
+        stcDatOut.objMfDat.close();
+
+        /* Read the bytes appended since the previous poll (behind the left over ones) */
+        objIfsDat.clear();
+        objIfsDat.seekg(0, std::ios_base::end);
+        std::streamoff const objOffFileSize = static_cast<std::streamoff>(objIfsDat.tellg());
+        if (0 > objOffFileSize) {
+            return error::enmErrorFileDne;
+        }
+        uint64_t const u64FileSizeBytes = static_cast<uint64_t>(objOffFileSize);
+        if (u64FileOffsetBytes > u64FileSizeBytes) {
+            // Truncated or replaced
+            return error::enmErrorFileSize;
+        }
+        size_t const sizNewBytes = static_cast<size_t>(u64FileSizeBytes - u64FileOffsetBytes);
+        if (0 != sizNewBytes) {
+            objIfsDat.seekg(static_cast<std::streamoff>(u64FileOffsetBytes), std::ios_base::beg);
+            u64FileOffsetBytes += static_cast<uint64_t>(readFileBytes(objIfsDat, sizNewBytes, vctChrPending));
+        }
+
+        /* Decode complete samples */
+        stcDatOut.bSimpleSampling = (1 == stcCfgIn.vctSamplingRateInfo.size());
+        stcDatOut.u64FirstSampleIdx = u64SamplesRead;
+        stcDatOut.u32PrevSampleNumber = u32PrevSampleNumber;
+        size_t sizConsumedBytes = 0;
+        error::enmErrorType const enmErrRet = (enmDataFileFormatAscii == stcCfgIn.enmDataFileFormat)
+            ? decodeBufferedAsciiSamples(
+                stcCfgIn,
+                stcDatOut,
+                vctChrPending.data(),
+                vctChrPending.size(),
+                SIZE_MAX,
+                (0 == sizNewBytes),
+                sizConsumedBytes
+            )
+            : decodeBufferedBinarySamples(
+                stcCfgIn,
+                stcDatOut,
+                vctChrPending.data(),
+                vctChrPending.size(),
+                SIZE_MAX,
+                sizConsumedBytes
+            );
+        if (error::enmErrorNone != enmErrRet) {
+            DIAG_LOG(
+                diag::enmLevelWarning,
+                ("Cannot decode appended samples of data file " + stcCfgIn.strDatFileName + ": " + error::getMessage(enmErrRet))
+            );
+            return enmErrRet;
+        }
+        indexChannelStorage(stcCfgIn, stcDatOut);
+
+        // Keep only the incomplete sample (at most one) for the next poll
+        vctChrPending.erase(vctChrPending.begin(), (vctChrPending.begin() + static_cast<std::ptrdiff_t>(sizConsumedBytes)));
+        u64SamplesRead += stcDatOut.u64TotalSamples;
+        u32PrevSampleNumber = stcDatOut.u32PrevSampleNumber;
+
+        /* Mark initialized */
+        stcDatOut.bInit = true;
+        return error::enmErrorNone;
+    }
+
+    error::enmErrorType
+        clsSampleCursor::open(
+            stcConfigFileType const& stcCfg,
+            size_t const sizBlockSamples
+        ) {
+        close();
+        if ((!stcCfg.bInit) || (0 == sizBlockSamples)) {
+            return error::enmErrorInvalidArg;
+        }
+        error::enmErrorType const enmErrOpen = utils::openFile(
+            stcCfg.strDatFileName,
+            (std::ifstream::binary | std::ifstream::in),
+            objIfsDat
+        );
+        if (error::enmErrorNone != enmErrOpen) {
+            return enmErrOpen;
         }
-        else {
+        ptrStcCfg = &stcCfg;
+        sizMaxBlockSamples = sizBlockSamples;
+        return error::enmErrorNone;
+    }
+
+    void
+        clsSampleCursor::close(
+            void
+        ) {
+        ptrStcCfg = nullptr;
+        objIfsDat.close();
+        objIfsDat.clear();
+        sizMaxBlockSamples = 0;
+        bEndOfFile = false;
+        u64SamplesRead = 0;
+        u32PrevSampleNumber = 0;
+        vctChrPending.clear();
+        vctChrPending.shrink_to_fit();
+    }
+
+    error::enmErrorType
+        clsSampleCursor::next(
+            stcDataFileType& stcBlockOut
+        ) {
+        if (!isOpen()) {
             return error::enmErrorInvalidArg;
         }
+        stcConfigFileType const& stcCfgIn = *ptrStcCfg;
+        bool const bAscii = (enmDataFileFormatAscii == stcCfgIn.enmDataFileFormat);
+        size_t const sizStrideBytes = bAscii ? 0 : static_cast<size_t>(getBinarySampleSizeBytes(stcCfgIn));
+        // ASCII lines have no fixed length, so they are read in chunks until the block is covered
+        size_t const sizAsciiReadBytes = (static_cast<size_t>(1) << 20);
 
-        std::cout << "Time Base (sec): " << std::fixed << std::setprecision(6) << stcCfg.f64TimeMult << std::endl;
+        /* Un-initialize configuration data */
+        stcBlockOut.bInit = false;
+        stcBlockOut.bLazy = false;
+        stcBlockOut.objMfDat.close();
+        stcBlockOut.bSimpleSampling = (1 == stcCfgIn.vctSamplingRateInfo.size());
+
+        // Blank lines may leave a block empty before the end of the record, so decode until it is not
+        do {
+            size_t const sizWantSamples = static_cast<size_t>(
+                std::min(static_cast<uint64_t>(sizMaxBlockSamples), (stcCfgIn.u64TotalSamples - u64SamplesRead))
+                );
 
-        std::cout << std::endl;
+            /* Read until the buffer covers the block (or the file ends) */
+            if (bAscii) {
+                size_t sizNumLines = static_cast<size_t>(std::count(vctChrPending.begin(), vctChrPending.end(), '\n'));
+                while ((sizWantSamples > sizNumLines) && (!bEndOfFile)) {
+                    size_t const sizPrevBytes = vctChrPending.size();
+                    bEndOfFile = (0 == readFileBytes(objIfsDat, sizAsciiReadBytes, vctChrPending));
+                    sizNumLines += static_cast<size_t>(std::count((vctChrPending.begin() + sizPrevBytes), vctChrPending.end(), '\n'));
+                }
+            }
+            else if (((sizWantSamples * sizStrideBytes) > vctChrPending.size()) && (!bEndOfFile)) {
+                size_t const sizMissingBytes = ((sizWantSamples * sizStrideBytes) - vctChrPending.size());
+                bEndOfFile = (sizMissingBytes > readFileBytes(objIfsDat, sizMissingBytes, vctChrPending));
+            }
+
+            /* Decode the block */
+            stcBlockOut.u64FirstSampleIdx = u64SamplesRead;
+            stcBlockOut.u32PrevSampleNumber = u32PrevSampleNumber;
+            size_t sizConsumedBytes = 0;
+            error::enmErrorType const enmErrRet = bAscii
+                ? decodeBufferedAsciiSamples(
+                    stcCfgIn,
+                    stcBlockOut,
+                    vctChrPending.data(),
+                    vctChrPending.size(),
+                    sizWantSamples,
+                    bEndOfFile,
+                    sizConsumedBytes
+                )
+                : decodeBufferedBinarySamples(
+                    stcCfgIn,
+                    stcBlockOut,
+                    vctChrPending.data(),
+                    vctChrPending.size(),
+                    sizWantSamples,
+                    sizConsumedBytes
+                );
+            if (error::enmErrorNone != enmErrRet) {
+                DIAG_LOG(
+                    diag::enmLevelWarning,
+                    ("Cannot decode data file " + stcCfgIn.strDatFileName + ": " + error::getMessage(enmErrRet))
+                );
+                return enmErrRet;
+            }
+            if ((0 != sizWantSamples) && (0 == sizConsumedBytes) && bEndOfFile) {
+                // Fewer samples than configured
+                DIAG_LOG(
+                    diag::enmLevelWarning,
+                    ("Data file " + stcCfgIn.strDatFileName + " ends after " + std::to_string(u64SamplesRead) + " samples")
+                );
+                return error::enmErrorFileSize;
+            }
+
+            vctChrPending.erase(vctChrPending.begin(), (vctChrPending.begin() + static_cast<std::ptrdiff_t>(sizConsumedBytes)));
+            u64SamplesRead += stcBlockOut.u64TotalSamples;
+            u32PrevSampleNumber = stcBlockOut.u32PrevSampleNumber;
+        } while ((0 == stcBlockOut.u64TotalSamples) && (stcCfgIn.u64TotalSamples > u64SamplesRead));
+        indexChannelStorage(stcCfgIn, stcBlockOut);
 
+        /* Mark initialized */
+        stcBlockOut.bInit = true;
         return error::enmErrorNone;
     }
 
-
-    static error::enmErrorType
-        parseAsciiDataFile(
-            stcConfigFileType const& stcCfgIn,
-            stcDataFileType& stcDatOut,
-            std::ifstream& objIfsDat
+    error::enmErrorType
+        getAnalogChannel(
+            stcConfigFileType const& stcCfg,
+            stcDataFileType& stcDat,
+            std::string_view const objSvChanName,
+            stcAnalogChannelViewType& stcAnaChanViewOut
         ) {
-        // TODO
-        return error::enmErrorNotImpl;
+        if (!stcDat.bInit) {
+            return error::enmErrorInvalidArg;
+        }
+        // Resolve the name once (index handle into the columnar store)
+        size_t const sizChanIdx = stcDat.objVmChanAnaData.find(objSvChanName);
+        if (stcDat.objVmChanAnaData.npos == sizChanIdx) {
+            return error::enmErrorInvalidArg;
+        }
+        return getAnalogChannel(stcCfg, stcDat, sizChanIdx, stcAnaChanViewOut);
     }
 
-    static error::enmErrorType
-        parseBinaryDataFile(
-            stcConfigFileType const& stcCfgIn,
-            stcDataFileType& stcDatOut,
-            std::ifstream& objIfsDat
+    error::enmErrorType
+        getAnalogChannel(
+            stcConfigFileType const& stcCfg,
+            stcDataFileType& stcDat,
+            size_t const sizChanIdx,
+            stcAnalogChannelViewType& stcAnaChanViewOut
         ) {
-        /* 6.5 Binary data files */
-        //
-        // Notes
-        //     - marshalling (little endian)
-        //         - "the standard DOS format is to store the least significant byte (LSB) of the
-        //           data first"
-        //     - sample size
-        //         - "the number of bytes required for each sample in the file will be:
-        //             - (Ak * 2) + (2 * INT(Dm/16)) + 4 + 4"
-        //         - "INT(Dm/16) is the number of status channels divided by 16 and rounded up to
-        //           the next integer"
-        // 
-        // Sequence
-        //     - sample number (uint32_t)
-        //         - "unsigned binary form of four bytes"
-        //     - timestamp (uint32_t)
-        //         - "unsigned binary form of four bytes"
-        //         - "hexadecimal 8000 is reserved to mark missing data"
-        //     - analog channel sample data (int16_t)
-        //         - "two's complement binary format of two bytes each"
-        //     - status [digital] channel sample data (uint16_t, bitfield)
-        //         - "stored in groups of two bytes for each 16 status channels, with the least
-        //           significant bit of a word assigned to the smallest input channel number
-        //           belonging to that group of 16 channels"
+        if (!stcCfg.bInit) {
+            return error::enmErrorInvalidArg;
+        }
+        if (!stcDat.bInit) {
+            return error::enmErrorInvalidArg;
+        }
+        if (stcDat.vctAnaChanData.size() <= sizChanIdx) {
+            return error::enmErrorInvalidArg;
+        }
+        stcAnalogChannelDataType& stcAnaChanData = stcDat.vctAnaChanData[sizChanIdx];
+        if (!stcAnaChanData.bLoaded) {
+            if (!stcDat.bLazy) {
+                return error::enmErrorInvalidArg;
+            }
 
-        if (stcDatOut.bSimpleSampling) {
-            /* Calculate sample size */
-            stcDatOut.u32SampleSizeBytes = static_cast<uint32_t>(
-                // sample number
-                (4)
-                // timestamp
-                + (4)
-                // analog channels
-                + (2 * stcCfgIn.u32NumAnaChannels)
-                // digital channels
-                + (2 * static_cast<uint32_t>(ceil(stcCfgIn.u32NumDigChannels / 16)))
+            // Decode the channel from the retained mapping (one pass over the file)
+            size_t const sizTotalSamp = static_cast<size_t>(stcDat.u64TotalSamples);
+            mf::stcStrideTableType const stcSampleTable = getSampleTable(stcDat, stcDat.objMfDat);
+            stcAnaChanData.ptrI32DataRaw = stcDat.objArena.allocate<int32_t>(sizTotalSamp);
+            stcAnaChanData.ptrF64Data = stcDat.objArena.allocate<float64_t>(sizTotalSamp);
+            if (0 != sizTotalSamp) {
+                getBinaryDecoder(stcCfg).fcnDecodeAnalogChannel(
+                    stcCfg, stcDat, stcSampleTable, sizChanIdx, 0, sizTotalSamp, nullptr
                 );
+            }
+            stcAnaChanData.bLoaded = true;
 
-            /* Read and parse each sample */
-            stcDatOut.u32PrevSampleNumber = 0;
-            uint64_t const u64TotalSamp = stcDatOut.u64TotalSamples;
-            char* const ptrChrBuf = new char[stcDatOut.u32SampleSizeBytes];
+            stcAnalogChannelViewType& stcAnaChanView = stcDat.objVmChanAnaData.at(sizChanIdx);
+            stcAnaChanView.ptrI32DataRaw = stcAnaChanData.ptrI32DataRaw;
+            stcAnaChanView.ptrF64Data = stcAnaChanData.ptrF64Data;
+        }
 
-            uint64_t u64SplitCount = 0;
+        stcAnaChanViewOut = stcDat.objVmChanAnaData[sizChanIdx];
+        return error::enmErrorNone;
+    }
 
-            for (size_t sizIter = 0; u64TotalSamp > sizIter; ++sizIter) {
-                if (sizIter > (u64SplitCount * (u64TotalSamp / 20))) {
-                    std::cout << ".";
-                    ++u64SplitCount;
-                }
+    error::enmErrorType
+        getDigitalChannel(
+            stcConfigFileType const& stcCfg,
+            stcDataFileType& stcDat,
+            std::string_view const objSvChanName,
+            stcDigitalChannelViewType& stcDigChanViewOut
+        ) {
+        if (!stcDat.bInit) {
+            return error::enmErrorInvalidArg;
+        }
+        // Resolve the name once (index handle into the columnar store)
+        size_t const sizChanIdx = stcDat.objVmChanDigData.find(objSvChanName);
+        if (stcDat.objVmChanDigData.npos == sizChanIdx) {
+            return error::enmErrorInvalidArg;
+        }
+        return getDigitalChannel(stcCfg, stcDat, sizChanIdx, stcDigChanViewOut);
+    }
 
-                // Read sample
-                objIfsDat.read(ptrChrBuf, stcDatOut.u32SampleSizeBytes);
-                char const* ptrChrAt = ptrChrBuf;
-                stcSampleDataType stcSampleData{};
+    error::enmErrorType
+        getDigitalChannel(
+            stcConfigFileType const& stcCfg,
+            stcDataFileType& stcDat,
+            size_t const sizChanIdx,
+            stcDigitalChannelViewType& stcDigChanViewOut
+        ) {
+        if (!stcCfg.bInit) {
+            return error::enmErrorInvalidArg;
+        }
+        if (!stcDat.bInit) {
+            return error::enmErrorInvalidArg;
+        }
+        if (stcDat.vctDigChanData.size() <= sizChanIdx) {
+            return error::enmErrorInvalidArg;
+        }
+        if (!stcDat.vctDigChanData[sizChanIdx].bLoaded) {
+            if (!stcDat.bLazy) {
+                return error::enmErrorInvalidArg;
+            }
 
-                // Parse sample count
-                stcSampleData.u32SampleNumber = utils::popU32Le(ptrChrAt);
+            // Decode every channel sharing the status word, since they cost the same pass
+            size_t const sizTotalSamp = static_cast<size_t>(stcDat.u64TotalSamples);
+            size_t const sizNumDigChan = static_cast<size_t>(stcCfg.u32NumDigChannels);
+            size_t const sizWordIdx = (sizChanIdx / 16);
+            size_t const sizFirstChan = (16 * sizWordIdx);
+            size_t const sizEndChan = std::min(sizNumDigChan, (sizFirstChan + 16));
+            mf::stcStrideTableType const stcSampleTable = getSampleTable(stcDat, stcDat.objMfDat);
+            size_t const sizNumWords = ((sizTotalSamp + 63) / 64);
+            for (size_t sizIter = sizFirstChan; sizEndChan > sizIter; ++sizIter) {
+                stcDat.vctDigChanData[sizIter].ptrU64Bits = stcDat.objArena.allocate<uint64_t>(sizNumWords);
+                std::fill_n(stcDat.vctDigChanData[sizIter].ptrU64Bits, sizNumWords, 0);
+            }
+            if (0 != sizTotalSamp) {
+                decodeBinaryStatusWord(stcCfg, stcDat, stcSampleTable, sizWordIdx, 0, sizTotalSamp);
+            }
+            for (size_t sizIter = sizFirstChan; sizEndChan > sizIter; ++sizIter) {
+                stcDat.vctDigChanData[sizIter].bLoaded = true;
+                stcDat.objVmChanDigData.at(sizIter).ptrU64Bits = stcDat.vctDigChanData[sizIter].ptrU64Bits;
+            }
+        }
 
-                // Validate sample count
-                if ((1 + stcDatOut.u32PrevSampleNumber) != stcSampleData.u32SampleNumber) {
-                    return error::emErrorOutOfOrder;
-                }
-                ++stcDatOut.u32PrevSampleNumber;
+        stcDigChanViewOut = stcDat.objVmChanDigData[sizChanIdx];
+        return error::enmErrorNone;
+    }
+
+    stcAnalogSampleViewType
+        getAnalogSampleView(
+            stcDataFileType const& stcDat,
+            stcSampleDataType const& stcSampleData
+        ) {
+        return stcAnalogSampleViewType{
+            stcDat.vctAnaChanData.data(),
+            stcDat.vctAnaChanData.size(),
+            static_cast<size_t>(stcSampleData.u32RowIdx)
+        };
+    }
+
+    stcDigitalSampleViewType
+        getDigitalSampleView(
+            stcDataFileType const& stcDat,
+            stcSampleDataType const& stcSampleData
+        ) {
+        return stcDigitalSampleViewType{
+            stcDat.vctDigChanData.data(),
+            stcDat.vctDigChanData.size(),
+            static_cast<size_t>(stcSampleData.u32RowIdx)
+        };
+    }
 
-                // Parse timestamp
-                stcSampleData.f64TimestampUs = (stcCfgIn.f64TimeMult * utils::popU32Le(ptrChrAt));
+    error::enmErrorType
+        getSampleTimeUs(
+            stcConfigFileType const& stcCfg,
+            uint64_t const u64SampleIdx,
+            float64_t& f64TimeUsOut
+        ) {
+        if (!stcCfg.bInit) {
+            return error::enmErrorInvalidArg;
+        }
+        if (u64SampleIdx >= stcCfg.u64TotalSamples) {
+            return error::enmErrorInvalidArg;
+        }
+        if (!stcCfg.bFixedRate) {
+            return error::enmErrorNotImpl;
+        }
 
-                // Parse analog channel sample data
-                uint32_t const u32NumAnaChannels = stcCfgIn.u32NumAnaChannels;
-                for (size_t sizIterJ = 0; u32NumAnaChannels > sizIterJ; ++sizIterJ) {
-                    stcAnalogDataType* const ptrStcAnaData = new stcAnalogDataType{};
-                    ptrStcAnaData->i16DataRaw = utils::popI16Le(ptrChrAt);
+        // Last segment starting at or before the sample
+        auto const objFindResult = std::upper_bound(
+            stcCfg.vctSampleSegments.begin(),
+            stcCfg.vctSampleSegments.end(),
+            u64SampleIdx,
+            [](uint64_t const u64Idx, stcSampleSegmentType const& stcSegment) {
+                return (u64Idx < stcSegment.u64FirstSampleIdx);
+            }
+        );
+        stcSampleSegmentType const& stcSegment = *(objFindResult - 1);
 
-                    stcAnalogChannelInfoType const stcAnaChanInfo = stcCfgIn.objVmAnalogChannelInfo[sizIterJ];
-                    float64_t const f64DataTmp = (
-                        (stcAnaChanInfo.f64ConvA * ptrStcAnaData->i16DataRaw)
-                        + stcAnaChanInfo.f64ConvB
-                        );
+        f64TimeUsOut = (
+            stcSegment.f64FirstTimeUs
+            + ((1.0e+06 * static_cast<float64_t>(u64SampleIdx - stcSegment.u64FirstSampleIdx)) / stcSegment.f64SamplesPerSec)
+            );
+        return error::enmErrorNone;
+    }
 
-                    // Validate engineering unit
-                    std::string const strUnit = stcAnaChanInfo.strUnit;
-                    auto const objFindResult = std::find(
-                        vctStrValidEngrUnits.begin(),
-                        vctStrValidEngrUnits.end(),
-                        strUnit.substr(strUnit.size() - 1)
-                    );
-                    if (vctStrValidEngrUnits.end() == objFindResult) {
-                        // Invalid base unit
-                        return error::enmErrorInvalidArg;
-                    }
-                    std::string const strPrefix = strUnit.substr(0, (strUnit.size() - 1));
-                    if (0 == mapUnitToConversion.count(strPrefix)) {
-                        // Invalid prefix
-                        return error::enmErrorInvalidArg;
-                    }
+    error::enmErrorType
+        getSampleIndexAtTime(
+            stcConfigFileType const& stcCfg,
+            float64_t const f64TimeUs,
+            uint64_t& u64SampleIdxOut
+        ) {
+        if (!stcCfg.bInit) {
+            return error::enmErrorInvalidArg;
+        }
+        if (!stcCfg.bFixedRate) {
+            return error::enmErrorNotImpl;
+        }
 
-                    // Convert according to unit (e.g., A vs kA)
-                    float64_t const f64EngUnitConv = mapUnitToConversion.at(strPrefix);
-                    ptrStcAnaData->f64Data = (f64EngUnitConv * f64DataTmp);
+        // Last segment starting at or before the time
+        auto const objFindResult = std::upper_bound(
+            stcCfg.vctSampleSegments.begin(),
+            stcCfg.vctSampleSegments.end(),
+            f64TimeUs,
+            [](float64_t const f64Time, stcSampleSegmentType const& stcSegment) {
+                return (f64Time < stcSegment.f64FirstTimeUs);
+            }
+        );
+        if (stcCfg.vctSampleSegments.begin() == objFindResult) {
+            // Before the first sample
+            u64SampleIdxOut = 0;
+            return error::enmErrorNone;
+        }
+        stcSampleSegmentType const& stcSegment = *(objFindResult - 1);
 
-                    stcChannelInfoType const stcChannelInfo = stcAnaChanInfo.stcChannelInfo;
-                    std::string const strName = stcChannelInfo.strName;
-                    stcSampleData.objVmSampleAnaData.insert(strName, ptrStcAnaData);
+        // Round up to the next sample, tolerating floating-point error in the time itself
+        float64_t const f64Offset = std::ceil(
+            (((f64TimeUs - stcSegment.f64FirstTimeUs) * stcSegment.f64SamplesPerSec) * 1.0e-06) - 1.0e-09
+        );
+        u64SampleIdxOut = std::min(
+            stcSegment.u64EndSampleIdx,
+            (stcSegment.u64FirstSampleIdx + static_cast<uint64_t>(f64Offset))
+        );
+        return error::enmErrorNone;
+    }
 
-                    // Store analog data by channel
-                    if (0 == stcDatOut.objVmChanAnaData.count(strName)) {
-                        // Insert new channel
-                        stcDatOut.objVmChanAnaData.insert(strName, new std::vector<stcAnalogDataType*>{});
-                    }
-                    stcDatOut.objVmChanAnaData[strName]->push_back(ptrStcAnaData);
-                }
+    error::enmErrorType
+        getDigitalEdges(
+            stcDataFileType const& stcDat,
+            std::string_view const objSvChanName,
+            std::vector<uint64_t>& vctU64SampleIdxOut
+        ) {
+        if (!stcDat.bInit) {
+            return error::enmErrorInvalidArg;
+        }
+        size_t const sizChanIdx = stcDat.objVmChanDigData.find(objSvChanName);
+        if (stcDat.objVmChanDigData.npos == sizChanIdx) {
+            return error::enmErrorInvalidArg;
+        }
 
-                // Store analog data by sample
-                stcDatOut.vctSampleData.push_back(stcSampleData);
+        stcDigitalChannelViewType const& stcDigChanView = stcDat.objVmChanDigData[sizChanIdx];
+        if (nullptr == stcDigChanView.ptrU64Bits) {
+            // Not loaded yet (see `getDigitalChannel`)
+            return error::enmErrorInvalidArg;
+        }
 
-                // Parse digital channel sample data
-                // TODO
+        vctU64SampleIdxOut.clear();
+        size_t const sizNumSamples = stcDigChanView.size();
+        size_t const sizNumWords = ((sizNumSamples + 63) / 64);
+        if (0 == sizNumWords) {
+            return error::enmErrorNone;
+        }
 
-                // Store digital data by sample
-                // TODO
+        // Compare every bit against its predecessor, one word (64 samples) at a time; the first
+        // sample is its own predecessor so it never counts as an edge
+        uint64_t u64Carry = (stcDigChanView.ptrU64Bits[0] & 1);
+        for (size_t sizWordIdx = 0; sizNumWords > sizWordIdx; ++sizWordIdx) {
+            uint64_t const u64Bits = stcDigChanView.ptrU64Bits[sizWordIdx];
+            uint64_t u64Edges = (u64Bits ^ ((u64Bits << 1) | u64Carry));
+            u64Edges &= getValidBitMask(sizNumSamples, sizWordIdx);
+            u64Carry = (u64Bits >> 63);
+
+            while (0 != u64Edges) {
+                vctU64SampleIdxOut.push_back((64 * sizWordIdx) + countTrailingZeros(u64Edges));
+                u64Edges &= (u64Edges - 1);
             }
-            delete[] ptrChrBuf;
         }
 
         return error::enmErrorNone;
     }
 
     error::enmErrorType
-        parseDataFile(
-            stcConfigFileType const& stcCfgIn,
-            stcDataFileType& stcDatOut
+        findDigitalChange(
+            stcDataFileType const& stcDat,
+            std::string_view const objSvChanName,
+            uint64_t const u64FromSampleIdx,
+            uint64_t& u64SampleIdxOut
         ) {
-        if (!stcCfgIn.bInit) {
+        if (!stcDat.bInit) {
+            return error::enmErrorInvalidArg;
+        }
+        size_t const sizChanIdx = stcDat.objVmChanDigData.find(objSvChanName);
+        if (stcDat.objVmChanDigData.npos == sizChanIdx) {
             return error::enmErrorInvalidArg;
         }
 
-        std::cout << "? ? ? INFO ? ? ? Parsing data file";
-
-        /* Un-initialize configuration data */
-        stcDatOut.bInit = false;
+        stcDigitalChannelViewType const& stcDigChanView = stcDat.objVmChanDigData[sizChanIdx];
+        if (nullptr == stcDigChanView.ptrU64Bits) {
+            // Not loaded yet (see `getDigitalChannel`)
+            return error::enmErrorInvalidArg;
+        }
+        size_t const sizNumSamples = stcDigChanView.size();
+        size_t const sizNumWords = ((sizNumSamples + 63) / 64);
+        u64SampleIdxOut = static_cast<uint64_t>(sizNumSamples);
+
+        // The first sample has no predecessor, so the earliest possible change is sample 1
+        size_t const sizFrom = std::max(static_cast<size_t>(1), static_cast<size_t>(u64FromSampleIdx));
+        if (sizFrom >= sizNumSamples) {
+            return error::enmErrorNone;
+        }
 
-        /* Open data file */
-        std::ifstream objIfsDat;
-        error::enmErrorType enmErrOpen = utils::openFile(
-            stcCfgIn.strDatFileName,
-            (std::ifstream::binary | std::ifstream::in),
-            objIfsDat
-        );
-        if (error::enmErrorNone != enmErrOpen) {
-            objIfsDat.close();
-            return enmErrOpen;
+        size_t sizWordIdx = (sizFrom / 64);
+        uint64_t u64Carry = ((0 == sizWordIdx) ? 0 : (stcDigChanView.ptrU64Bits[sizWordIdx - 1] >> 63));
+        uint64_t u64FromMask = (~static_cast<uint64_t>(0) << (sizFrom % 64));
+        for (; sizNumWords > sizWordIdx; ++sizWordIdx) {
+            uint64_t const u64Bits = stcDigChanView.ptrU64Bits[sizWordIdx];
+            uint64_t const u64Edges = (
+                (u64Bits ^ ((u64Bits << 1) | u64Carry))
+                & getValidBitMask(sizNumSamples, sizWordIdx)
+                & u64FromMask
+                );
+            if (0 != u64Edges) {
+                u64SampleIdxOut = ((64 * sizWordIdx) + countTrailingZeros(u64Edges));
+                break;
+            }
+            u64Carry = (u64Bits >> 63);
+            u64FromMask = ~static_cast<uint64_t>(0);
         }
 
-        /* Variables for parsing */
-        error::enmErrorType enmErrRet = error::enmErrorNone;
-        stcDatOut.bSimpleSampling = false;
-        stcDatOut.u64TotalSamples = 0;
-        if (1 == stcCfgIn.vctSamplingRateInfo.size()) {
-            // don't have to worry about reading different sampling rates and coordinating
-            stcDatOut.bSimpleSampling = true;
-            // total sample quantity matches last sample number
-            stcDatOut.u64TotalSamples = stcCfgIn.vctSamplingRateInfo[0].u64LastSampleNumber;
-        }
-        if (!stcDatOut.bSimpleSampling) {
-            std::cerr << "? ? ? INFO ? ? ? Multiple sampling rates not supported." << std::endl;
-            enmErrRet = error::enmErrorNotImpl;
-            goto cleanup;
+        return error::enmErrorNone;
+    }
+
+    error::enmErrorType
+        findDigitalChangeAfterTrigger(
+            stcConfigFileType const& stcCfg,
+            stcDataFileType const& stcDat,
+            std::string_view const objSvChanName,
+            uint64_t& u64SampleIdxOut
+        ) {
+        if (!stcCfg.bInit) {
+            return error::enmErrorInvalidArg;
+        }
+        if (!stcDat.bInit) {
+            return error::enmErrorInvalidArg;
         }
 
-        switch (stcCfgIn.enmDataFileFormat) {
-        case comtrade::enmDataFileFormatAscii: {
-            enmErrRet = parseAsciiDataFile(stcCfgIn, stcDatOut, objIfsDat);
-            break;
+        return findDigitalChange(
+            stcDat,
+            objSvChanName,
+            getTriggerSampleIndex(stcCfg, stcDat),
+            u64SampleIdxOut
+        );
+    }
+
+    error::enmErrorType
+        countDigitalSet(
+            stcDataFileType const& stcDat,
+            std::string_view const objSvChanName,
+            uint64_t const u64BeginSampleIdx,
+            uint64_t const u64EndSampleIdx,
+            uint64_t& u64CountOut
+        ) {
+        if (!stcDat.bInit) {
+            return error::enmErrorInvalidArg;
         }
-        case comtrade::enmDataFileFormatBinary: {
-            enmErrRet = parseBinaryDataFile(stcCfgIn, stcDatOut, objIfsDat);
-            break;
+        size_t const sizChanIdx = stcDat.objVmChanDigData.find(objSvChanName);
+        if (stcDat.objVmChanDigData.npos == sizChanIdx) {
+            return error::enmErrorInvalidArg;
         }
-        default: {
-            enmErrRet = error::enmErrorInvalidArg;
-            goto cleanup;
-            break;
+
+        stcDigitalChannelViewType const& stcDigChanView = stcDat.objVmChanDigData[sizChanIdx];
+        if (nullptr == stcDigChanView.ptrU64Bits) {
+            // Not loaded yet (see `getDigitalChannel`)
+            return error::enmErrorInvalidArg;
         }
+        if (
+            (u64BeginSampleIdx > u64EndSampleIdx)
+            || (static_cast<uint64_t>(stcDigChanView.size()) < u64EndSampleIdx)
+            ) {
+            return error::enmErrorInvalidArg;
         }
 
-        /* Mark initialized */
-        stcDatOut.bInit = true;
+        u64CountOut = 0;
+        size_t const sizBegin = static_cast<size_t>(u64BeginSampleIdx);
+        size_t const sizEnd = static_cast<size_t>(u64EndSampleIdx);
+        for (size_t sizWordIdx = (sizBegin / 64); sizEnd > (64 * sizWordIdx); ++sizWordIdx) {
+            uint64_t u64Bits = (stcDigChanView.ptrU64Bits[sizWordIdx] & getValidBitMask(sizEnd, sizWordIdx));
+            if ((sizBegin / 64) == sizWordIdx) {
+                u64Bits &= (~static_cast<uint64_t>(0) << (sizBegin % 64));
+            }
+            u64CountOut += static_cast<uint64_t>(std::bitset<64>(u64Bits).count());
+        }
 
-    cleanup:
-        std::cout << " Done." << std::endl;
-        objIfsDat.close();
-        return enmErrRet;
+        return error::enmErrorNone;
     }
 
     error::enmErrorType
@@ -690,17 +2911,28 @@ namespace comtrade {
         std::cout << "Time (us):\t" << stcDat.vctSampleData[sizSampleIdx].f64TimestampUs << std::endl;
 
         // Print analog samples
-        auto const objVmSampleAnaData = stcDat.vctSampleData[sizSampleIdx].objVmSampleAnaData;
-        for (size_t sizIter = 0; objVmSampleAnaData.size() > sizIter; ++sizIter) {
-            stcAnalogChannelInfoType const stcAnaChanInfo = stcCfg.objVmAnalogChannelInfo[sizIter];
-            stcChannelInfoType const stcChanInfo = stcAnaChanInfo.stcChannelInfo;
-            std::string const strName = stcChanInfo.strName;
-            std::cout << "Channel " << (1 + sizIter) << ":\t" << objVmSampleAnaData[sizIter]->f64Data
+        stcAnalogSampleViewType const stcAnaSampleView = getAnalogSampleView(stcDat, stcDat.vctSampleData[sizSampleIdx]);
+        for (size_t sizIter = 0; stcAnaSampleView.size() > sizIter; ++sizIter) {
+            if (!stcDat.vctAnaChanData[sizIter].bLoaded) {
+                // Not loaded yet (lazy mode)
+                continue;
+            }
+            std::string const& strName = stcCfg.objVmAnalogChannelInfo[sizIter].stcChannelInfo.strName;
+            std::cout << "Channel " << (1 + sizIter) << ":\t" << stcAnaSampleView[sizIter].f64Data
                 << "\t" << strName << std::endl;
         }
 
         // Print digital samples
-        // TODO
+        stcDigitalSampleViewType const stcDigSampleView = getDigitalSampleView(stcDat, stcDat.vctSampleData[sizSampleIdx]);
+        for (size_t sizIter = 0; stcDigSampleView.size() > sizIter; ++sizIter) {
+            if (!stcDat.vctDigChanData[sizIter].bLoaded) {
+                // Not loaded yet (lazy mode)
+                continue;
+            }
+            std::string const& strName = stcCfg.objVmDigitalChannelInfo[sizIter].stcChannelInfo.strName;
+            std::cout << "Status " << (1 + sizIter) << ":\t" << stcDigSampleView[sizIter]
+                << "\t" << strName << std::endl;
+        }
 
         std::cout << std::endl;
 
@@ -719,9 +2951,11 @@ namespace comtrade {
         if (!stcDat.bInit) {
             return error::enmErrorInvalidArg;
         }
+        size_t const sizAnaChanIdx = stcDat.objVmChanAnaData.find(strChanName);
+        size_t const sizDigChanIdx = stcDat.objVmChanDigData.find(strChanName);
         if (
-            (0 == stcDat.objVmChanAnaData.count(strChanName))
-            && (0 == stcDat.objVmChanDigData.count(strChanName))
+            (stcDat.objVmChanAnaData.npos == sizAnaChanIdx)
+            && (stcDat.objVmChanDigData.npos == sizDigChanIdx)
             ) {
             return error::enmErrorInvalidArg;
         }
@@ -730,22 +2964,29 @@ namespace comtrade {
 
         std::cout << "Channel:\t" << strChanName << std::endl;
 
-        if (0 != stcDat.objVmChanAnaData.count(strChanName)) {
+        if (stcDat.objVmChanAnaData.npos != sizAnaChanIdx) {
             // Print analog channel
-            std::vector<stcAnalogDataType*> const vctAnaData = *stcDat.objVmChanAnaData[strChanName];
-            uint64_t u64SampleIter = 0;
-            for (stcAnalogDataType const* const ptrStcAnaData : vctAnaData) {
-                ++u64SampleIter;
-                std::cout << "Sample " << (u64SampleIter) << ":\t" << ptrStcAnaData->f64Data << std::endl;
-                if (100 <= u64SampleIter) {
-                    break;
-                }
+            stcAnalogChannelViewType const& stcAnaChanView = stcDat.objVmChanAnaData[sizAnaChanIdx];
+            if (nullptr == stcAnaChanView.ptrF64Data) {
+                // Not loaded yet (see `getAnalogChannel`)
+                return error::enmErrorInvalidArg;
+            }
+            size_t const sizNumPrint = std::min(static_cast<size_t>(100), stcAnaChanView.size());
+            for (size_t sizIter = 0; sizNumPrint > sizIter; ++sizIter) {
+                std::cout << "Sample " << (1 + sizIter) << ":\t" << stcAnaChanView[sizIter].f64Data << std::endl;
             }
         }
-        else if (0 != stcDat.objVmChanDigData.count(strChanName)) {
+        else if (stcDat.objVmChanDigData.npos != sizDigChanIdx) {
             // Print digital channel
-            // TODO
-            return error::enmErrorNotImpl;
+            stcDigitalChannelViewType const& stcDigChanView = stcDat.objVmChanDigData[sizDigChanIdx];
+            if (nullptr == stcDigChanView.ptrU64Bits) {
+                // Not loaded yet (see `getDigitalChannel`)
+                return error::enmErrorInvalidArg;
+            }
+            size_t const sizNumPrint = std::min(static_cast<size_t>(100), stcDigChanView.size());
+            for (size_t sizIter = 0; sizNumPrint > sizIter; ++sizIter) {
+                std::cout << "Sample " << (1 + sizIter) << ":\t" << stcDigChanView[sizIter] << std::endl;
+            }
         }
         else {
             return error::enmErrorInvalidArg;
@@ -15,10 +15,15 @@
 
 #pragma once
 
+#include <fstream>
+#include <functional>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "arena.h"
 #include "error.h"
+#include "mappedFile.h"
 #include "types.h"
 #include "vectorMap.h"
 
@@ -52,11 +57,25 @@ namespace comtrade {
         float64_t f64ConvA;
         float64_t f64ConvB;
 
-        // ignoring skew, min, max, primary, secondary, PS
+        // range of the values as stored in the data file (NaN if left blank)
+        float64_t f64RawMin;
+        float64_t f64RawMax;
+
+        // ignoring skew, primary, secondary, PS
         //
         // note that skew, primary, secondary, and PS would be needed if using real-world data
     };
 
+    // Scaling from raw sample value to engineering units, fused with the unit prefix (e.g., kA)
+    //
+    //     f64Data = (f64Mult * raw) + f64Offset
+    //
+    // where f64Mult = (a * prefix) and f64Offset = (b * prefix)
+    struct stcAnalogScalingType {
+        float64_t f64Mult;
+        float64_t f64Offset;
+    };
+
     // 5.3.4 --> Dn, ch_id, ph, ccbm, y
     struct stcDigitalChannelInfoType {
         // generic channel info
@@ -71,6 +90,19 @@ namespace comtrade {
         uint64_t u64LastSampleNumber;
     };
 
+    // Contiguous run of samples recorded at a single sampling rate (derived from the configuration)
+    struct stcSampleSegmentType {
+        // [u64FirstSampleIdx, u64EndSampleIdx) (0-based sample indices)
+        uint64_t u64FirstSampleIdx;
+        uint64_t u64EndSampleIdx;
+
+        // 0 --> no fixed rate (sample times are only known from the data file timestamps)
+        float64_t f64SamplesPerSec;
+
+        // time of the first sample in the segment, relative to the first sample of the record
+        float64_t f64FirstTimeUs;
+    };
+
     struct stcDateTimeType {
 
         struct stcDateType {
@@ -87,14 +119,53 @@ namespace comtrade {
 
     };
 
+    // 5.3.7 --> ft (BINARY32 and FLOAT32 from the 2013 revision)
     enum enmDataFileFormatType {
         enmDataFileFormatAscii,
         enmDataFileFormatBinary,
+        enmDataFileFormatBinary32,
+        enmDataFileFormatFloat32,
 
         enmDataFileFormatTypeCount
     };
 
+    // Raw analog values reserved to mark missing data (FLOAT32 marks it with NaN)
+    constexpr int32_t i32MissingValueAscii = 99999;
+    // 0x8000 (sign-extended)
+    constexpr int32_t i32MissingValueBinary = -32768;
+    // 0x80000000
+    constexpr int32_t i32MissingValueBinary32 = (-2147483647 - 1);
+
+    // Whether a raw analog value (see `stcAnalogDataType::i32DataRaw`) marks missing data
+    inline bool
+        isMissingValue(
+            enmDataFileFormatType const enmFormat,
+            int32_t const i32DataRaw
+        ) {
+        switch (enmFormat) {
+        case enmDataFileFormatAscii:
+            return (i32MissingValueAscii == i32DataRaw);
+        case enmDataFileFormatBinary:
+            return (i32MissingValueBinary == i32DataRaw);
+        case enmDataFileFormatBinary32:
+            return (i32MissingValueBinary32 == i32DataRaw);
+        case enmDataFileFormatFloat32:
+            // NaN (all exponent bits set, non-zero fraction)
+            return (0x7F800000 < (i32DataRaw & 0x7FFFFFFF));
+        default:
+            return false;
+        }
+    }
+
     struct stcConfigFileType {
+        stcConfigFileType() = default;
+
+        // Moved or reused, never copied by accident (see `parseConfigFile`)
+        stcConfigFileType(stcConfigFileType const&) = delete;
+        stcConfigFileType& operator=(stcConfigFileType const&) = delete;
+        stcConfigFileType(stcConfigFileType&&) noexcept = default;
+        stcConfigFileType& operator=(stcConfigFileType&&) noexcept = default;
+
         bool bInit = false;
 
         std::string strCfgFileName;
@@ -113,10 +184,19 @@ namespace comtrade {
         vm::clsVectorMap<std::string, stcAnalogChannelInfoType> objVmAnalogChannelInfo;
         vm::clsVectorMap<std::string, stcDigitalChannelInfoType> objVmDigitalChannelInfo;
 
+        // Validated scaling plan (indexed by analog channel)
+        std::vector<stcAnalogScalingType> vctAnaScaling;
+
         float32_t f32Frequency;
         uint32_t u32NumSamplingRates;
         std::vector<stcSamplingRateInfoType> vctSamplingRateInfo;
 
+        // Sample index <--> time lookup table (one entry per sampling rate)
+        std::vector<stcSampleSegmentType> vctSampleSegments;
+        // every segment has a fixed rate (sample times follow from sample indices alone)
+        bool bFixedRate;
+        uint64_t u64TotalSamples;
+
         stcDateTimeType stcDateTimeStart;
         stcDateTimeType stcDateTimeTrigger;
 
@@ -125,57 +205,543 @@ namespace comtrade {
     };
 
     struct stcAnalogDataType {
-        int16_t i16DataRaw;
+        // value as stored in the data file (for FLOAT32, the IEEE 754 bits of the `float`)
+        int32_t i32DataRaw;
         float64_t f64Data;
     };
 
-    struct stcDigitalDataType {
-        uint16_t u16DataRaw;
-        std::vector<bool> vctData;
+    // Columnar backing store for a single analog channel (one contiguous array per quantity)
+    struct stcAnalogChannelDataType {
+        // false until decoded (lazy mode only)
+        bool bLoaded;
+
+        // arrays of `u64TotalSamples` values owned by the record's arena (null until loaded)
+        int32_t* ptrI32DataRaw;
+        // NaN where the data file marks the value missing (see `isMissingValue`)
+        float64_t* ptrF64Data;
     };
 
+    // Thin view over the columnar store of a single analog channel (indexed by sample)
+    struct stcAnalogChannelViewType {
+        int32_t const* ptrI32DataRaw;
+        float64_t const* ptrF64Data;
+        size_t sizNumSamples;
+
+        size_t
+            size(
+                void
+            ) const {
+            return sizNumSamples;
+        }
+
+        stcAnalogDataType
+            operator[] (
+                size_t const sizSampleIdx
+                ) const {
+            return stcAnalogDataType{ ptrI32DataRaw[sizSampleIdx], ptrF64Data[sizSampleIdx] };
+        }
+    };
+
+    // Thin view over a single row of the columnar store (indexed by analog channel)
+    struct stcAnalogSampleViewType {
+        stcAnalogChannelDataType const* ptrStcAnaChanData;
+        size_t sizNumChannels;
+        size_t sizSampleIdx;
+
+        size_t
+            size(
+                void
+            ) const {
+            return sizNumChannels;
+        }
+
+        stcAnalogDataType
+            operator[] (
+                size_t const sizChanIdx
+                ) const {
+            stcAnalogChannelDataType const& stcAnaChanData = ptrStcAnaChanData[sizChanIdx];
+            return stcAnalogDataType{
+                stcAnaChanData.ptrI32DataRaw[sizSampleIdx],
+                stcAnaChanData.ptrF64Data[sizSampleIdx]
+            };
+        }
+    };
+
+    // Columnar backing store for a single digital channel (one bit per sample, packed LSB first)
+    struct stcDigitalChannelDataType {
+        // false until decoded (lazy mode only)
+        bool bLoaded;
+
+        // `ceil(u64TotalSamples / 64)` words owned by the record's arena (null until loaded)
+        uint64_t* ptrU64Bits;
+    };
+
+    // Thin view over the columnar store of a single digital channel (indexed by sample)
+    struct stcDigitalChannelViewType {
+        uint64_t const* ptrU64Bits;
+        size_t sizNumSamples;
+
+        size_t
+            size(
+                void
+            ) const {
+            return sizNumSamples;
+        }
+
+        bool
+            operator[] (
+                size_t const sizSampleIdx
+                ) const {
+            return (0 != ((ptrU64Bits[sizSampleIdx / 64] >> (sizSampleIdx % 64)) & 1));
+        }
+    };
+
+    // Thin view over a single row of the columnar store (indexed by digital channel)
+    struct stcDigitalSampleViewType {
+        stcDigitalChannelDataType const* ptrStcDigChanData;
+        size_t sizNumChannels;
+        size_t sizSampleIdx;
+
+        size_t
+            size(
+                void
+            ) const {
+            return sizNumChannels;
+        }
+
+        bool
+            operator[] (
+                size_t const sizChanIdx
+                ) const {
+            uint64_t const u64Word = ptrStcDigChanData[sizChanIdx].ptrU64Bits[sizSampleIdx / 64];
+            return (0 != ((u64Word >> (sizSampleIdx % 64)) & 1));
+        }
+    };
+
+    // A single sample: its number, its timestamp, and its row in the columnar store
+    //
+    // Channel values are not held per sample; see `getAnalogSampleView` / `getDigitalSampleView`.
     struct stcSampleDataType {
         uint32_t u32SampleNumber;
+        uint32_t u32RowIdx;
+        // NaN if missing (ASCII: blank; binary: 0xFFFFFFFF)
         float64_t f64TimestampUs;
-
-        vm::clsVectorMap<std::string, stcAnalogDataType*> objVmSampleAnaData;
-        vm::clsVectorMap<std::string, stcDigitalDataType*> objVmSampleDigData;
     };
 
     struct stcDataFileType {
+        stcDataFileType() = default;
+
+        // Moved or reused, never copied by accident (see `parseDataFile`)
+        stcDataFileType(stcDataFileType const&) = delete;
+        stcDataFileType& operator=(stcDataFileType const&) = delete;
+        stcDataFileType(stcDataFileType&&) noexcept = default;
+        stcDataFileType& operator=(stcDataFileType&&) noexcept = default;
+
         bool bInit = false;
 
         bool bSimpleSampling;
+        // Samples held (the whole record, or a slice of it starting at `u64FirstSampleIdx`)
+        uint64_t u64FirstSampleIdx;
         uint64_t u64TotalSamples;
         uint32_t u32SampleSizeBytes;
 
         uint32_t u32PrevSampleNumber;
 
-        // Storage by sample
+        // Owner of all channel data (released in one step when the record is reparsed or dropped)
+        ar::clsArena objArena;
+
+        // Columnar backing store (indexed by channel, then by sample)
+        std::vector<stcAnalogChannelDataType> vctAnaChanData;
+        std::vector<stcDigitalChannelDataType> vctDigChanData;
+
+        // Storage by sample (number, timestamp, and row into the columnar store)
         std::vector<stcSampleDataType> vctSampleData;
 
-        // Storage by channel
-        vm::clsVectorMap<std::string, std::vector<stcAnalogDataType*>*> objVmChanAnaData;
-        vm::clsVectorMap<std::string, std::vector<stcDigitalDataType*>*> objVmChanDigData;
+        // Storage by channel (views into the columnar store; null data until loaded in lazy mode)
+        vm::clsVectorMap<std::string, stcAnalogChannelViewType> objVmChanAnaData;
+        vm::clsVectorMap<std::string, stcDigitalChannelViewType> objVmChanDigData;
+
+        // Data file kept mapped so channels can be decoded on demand (lazy mode only)
+        bool bLazy;
+        mf::clsMappedFile objMfDat;
+    };
+
+    // Where the time of a data file parse went, and how much it did
+    //
+    // Phase times are summed over every thread taking part, so in a parallel parse they can add up
+    // to more than `u64TotalNs`. Pages of a mapped (binary) data file are read in as they are first
+    // touched, so for binary files that I/O shows up under decoding.
+    struct stcParseStatsType {
+        // data file bytes consumed (ASCII: read from the file; binary: the rows of the parsed range)
+        uint64_t u64BytesRead;
+        uint64_t u64SamplesParsed;
+        // samples without a timestamp (ASCII: blank; binary: 0xFFFFFFFF)
+        uint64_t u64MissingTimestamps;
+
+        // heap blocks taken for the record (channel arena, sample and channel tables, read buffer)
+        uint64_t u64Allocations;
+
+        // opening, mapping, and reading the data file
+        uint64_t u64IoNs;
+        // scanning text or unpacking binary fields into raw values
+        uint64_t u64DecodeNs;
+        // scaling raw values into engineering units
+        uint64_t u64ConvertNs;
+        // allocating and indexing the channel storage
+        uint64_t u64IndexNs;
+        uint64_t u64TotalNs;
+
+        float64_t f64SamplesPerSec;
     };
 
+    struct stcParseOptionsType {
+        // Worker threads used to decode binary data files (0 --> one per hardware thread, 1 --> serial)
+        uint32_t u32NumThreads = 1;
+
+        // Only validate and index binary data files; channels are decoded on first request through
+        // `getAnalogChannel` / `getDigitalChannel` (ASCII data files are always parsed in full)
+        bool bLazy = false;
+
+        // Filled in by the parse when set (reset first, so it only describes the latest parse)
+        stcParseStatsType* ptrStcStats = nullptr;
+
+        // Called about every 5% of the samples with (samples parsed, samples in total); calls never
+        // overlap, but may come from worker threads in a parallel parse
+        std::function<void(uint64_t, uint64_t)> fcnProgress;
+    };
+
+    // Parse a configuration file (`stcCfgOut` may hold a previous configuration; its strings and
+    // channel tables are overwritten in place, reusing their capacity)
     error::enmErrorType
         parseConfigFile(
             std::string const& strFileNamePrefix,
             stcConfigFileType& stcCfgOut
         );
 
+    // Parse only the header fields of a configuration file (station, device, channel counts,
+    // sampling rates, start/trigger time, format, time multiplier) for bulk indexing
+    //
+    // Channel definitions are skipped, the data file is not checked, and nothing is printed; the
+    // result is never marked initialized, so it cannot be used to parse a data file.
+    error::enmErrorType
+        parseConfigHeader(
+            std::string const& strCfgFileName,
+            stcConfigFileType& stcCfgOut
+        );
+
+    // Bytes per sample of a binary data file described by the configuration (6.5)
+    uint32_t
+        getBinarySampleSizeBytes(
+            stcConfigFileType const& stcCfg
+        );
+
     error::enmErrorType
         printConfigInfo(
             stcConfigFileType const& stcCfg
         );
 
+    // Parse a data file in full
+    //
+    // `stcDatOut` may be a record from a previous parse: its channel memory, sample table and
+    // (for the same channel layout) channel index are reused rather than rebuilt, so a stream of
+    // similar records settles into a fixed footprint.
     error::enmErrorType
         parseDataFile(
             stcConfigFileType const& stcCfgIn,
             stcDataFileType& stcDatOut
         );
 
+    error::enmErrorType
+        parseDataFile(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            stcParseOptionsType const& stcOpts
+        );
+
+    // Parse only the samples [u64FirstSampleIdx, u64FirstSampleIdx + u64NumSamples) of the record;
+    // binary data files are read straight from the bytes of the range (fixed stride), ASCII data
+    // files are scanned up to the end of the range. Sample indices of the result are relative to
+    // the first sample of the range.
+    error::enmErrorType
+        parseDataFileRange(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            uint64_t const u64FirstSampleIdx,
+            uint64_t const u64NumSamples,
+            stcParseOptionsType const& stcOpts
+        );
+
+    // Parse only the samples timed within [f64BeginUs, f64EndUs) of the trigger (negative -->
+    // before the trigger), e.g. -2 to +10 cycles is [-2e6 / f32Frequency, 10e6 / f32Frequency);
+    // requires fixed sampling rates
+    error::enmErrorType
+        parseDataFileWindow(
+            stcConfigFileType const& stcCfgIn,
+            stcDataFileType& stcDatOut,
+            float64_t const f64BeginUs,
+            float64_t const f64EndUs,
+            stcParseOptionsType const& stcOpts
+        );
+
+    // Incremental reader of a data file that is still being written (e.g., by a recorder during
+    // commissioning or live monitoring)
+    //
+    // The reader keeps its offset into the file and the bytes of any incomplete trailing sample, so
+    // each poll only reads and decodes what was appended since the previous one. Reading is not
+    // bounded by the configured sample count (the configuration of a live record may not be final).
+    // Polls may be driven by a timer or by a file change notification.
+    class clsDataFileTail {
+
+    public:
+        clsDataFileTail() {}
+
+        // Start from the first sample of the data file of `stcCfg` (which must outlive the reader)
+        error::enmErrorType
+            open(
+                stcConfigFileType const& stcCfg
+            );
+
+        void
+            close(
+                void
+            );
+
+        bool
+            isOpen(
+                void
+            ) const {
+            return (nullptr != ptrStcCfg);
+        }
+
+        // Decode the complete samples appended since the previous poll into `stcDatOut`, as a
+        // slice starting at sample `getSamplesRead()` (empty if nothing new was appended)
+        //
+        // A file that shrinks (e.g., replaced by a new record) fails with `enmErrorFileSize`.
+        error::enmErrorType
+            poll(
+                stcDataFileType& stcDatOut
+            );
+
+        // Samples decoded so far
+        uint64_t
+            getSamplesRead(
+                void
+            ) const {
+            return u64SamplesRead;
+        }
+
+        // Bytes of the data file consumed so far (up to the end of the last complete sample)
+        uint64_t
+            getOffsetBytes(
+                void
+            ) const {
+            return (u64FileOffsetBytes - static_cast<uint64_t>(vctChrPending.size()));
+        }
+
+        // Whether every sample listed by the configuration has been read
+        bool
+            isComplete(
+                void
+            ) const {
+            return (isOpen() && (ptrStcCfg->u64TotalSamples <= u64SamplesRead));
+        }
+
+    private:
+        stcConfigFileType const* ptrStcCfg = nullptr;
+        std::ifstream objIfsDat;
+
+        // end of the bytes read from the file so far
+        uint64_t u64FileOffsetBytes = 0;
+        uint64_t u64SamplesRead = 0;
+        uint32_t u32PrevSampleNumber = 0;
+
+        // bytes read but not yet decoded (incomplete trailing sample or line), followed by the
+        // newly appended bytes during a poll
+        std::vector<char> vctChrPending;
+
+    };
+
+    // Forward cursor over the samples of a record, decoding one block of samples at a time
+    //
+    // Memory stays bounded by the block size whatever the size of the data file: the file is read
+    // sequentially through a buffer of about one block, and passing the same block record to every
+    // `next` reuses its storage. Each block is a slice as produced by `parseDataFileRange`, so the
+    // channel, sample, and edge functions apply to it (sample `i` of a block is sample
+    // `u64FirstSampleIdx + i` of the record).
+    class clsSampleCursor {
+
+    public:
+        clsSampleCursor() {}
+
+        // Start before the first sample of the record of `stcCfg` (which must outlive the cursor),
+        // with blocks of at most `sizBlockSamples` samples
+        error::enmErrorType
+            open(
+                stcConfigFileType const& stcCfg,
+                size_t const sizBlockSamples = 65536
+            );
+
+        void
+            close(
+                void
+            );
+
+        bool
+            isOpen(
+                void
+            ) const {
+            return (nullptr != ptrStcCfg);
+        }
+
+        // Decode the next block of samples into `stcBlockOut` (empty once every sample listed by
+        // the configuration has been read)
+        //
+        // A data file with fewer samples than configured fails with `enmErrorFileSize` at its end.
+        error::enmErrorType
+            next(
+                stcDataFileType& stcBlockOut
+            );
+
+        // Samples decoded so far
+        uint64_t
+            getSamplesRead(
+                void
+            ) const {
+            return u64SamplesRead;
+        }
+
+        // Whether every sample listed by the configuration has been read
+        bool
+            isDone(
+                void
+            ) const {
+            return (isOpen() && (ptrStcCfg->u64TotalSamples <= u64SamplesRead));
+        }
+
+    private:
+        stcConfigFileType const* ptrStcCfg = nullptr;
+        std::ifstream objIfsDat;
+        size_t sizMaxBlockSamples = 0;
+        bool bEndOfFile = false;
+
+        uint64_t u64SamplesRead = 0;
+        uint32_t u32PrevSampleNumber = 0;
+
+        // bytes read but not yet decoded (at most about one block plus one read)
+        std::vector<char> vctChrPending;
+
+    };
+
+    // View of an analog channel, decoding and caching it first if the record was parsed in lazy
+    // mode (not thread-safe in lazy mode)
+    //
+    // A name resolves to the first channel listed under it; channels sharing a name are reached
+    // by index (configuration order).
+    error::enmErrorType
+        getAnalogChannel(
+            stcConfigFileType const& stcCfg,
+            stcDataFileType& stcDat,
+            std::string_view const objSvChanName,
+            stcAnalogChannelViewType& stcAnaChanViewOut
+        );
+
+    error::enmErrorType
+        getAnalogChannel(
+            stcConfigFileType const& stcCfg,
+            stcDataFileType& stcDat,
+            size_t const sizChanIdx,
+            stcAnalogChannelViewType& stcAnaChanViewOut
+        );
+
+    // View of a digital channel, decoding and caching it (and the rest of its status word) first
+    // if the record was parsed in lazy mode (not thread-safe in lazy mode; see `getAnalogChannel`
+    // for channels sharing a name)
+    error::enmErrorType
+        getDigitalChannel(
+            stcConfigFileType const& stcCfg,
+            stcDataFileType& stcDat,
+            std::string_view const objSvChanName,
+            stcDigitalChannelViewType& stcDigChanViewOut
+        );
+
+    error::enmErrorType
+        getDigitalChannel(
+            stcConfigFileType const& stcCfg,
+            stcDataFileType& stcDat,
+            size_t const sizChanIdx,
+            stcDigitalChannelViewType& stcDigChanViewOut
+        );
+
+    // Sample-major view of the analog channels of one sample, indexed by channel in configuration
+    // order, so a channel name resolves once through `stcConfigFileType::objVmAnalogChannelInfo`
+    // (e.g., `objVmAnalogChannelInfo.find("IA")`) and the index is shared by every sample
+    stcAnalogSampleViewType
+        getAnalogSampleView(
+            stcDataFileType const& stcDat,
+            stcSampleDataType const& stcSampleData
+        );
+
+    // Sample-major view of the digital channels of one sample (see `getAnalogSampleView`)
+    stcDigitalSampleViewType
+        getDigitalSampleView(
+            stcDataFileType const& stcDat,
+            stcSampleDataType const& stcSampleData
+        );
+
+    // Time of a sample relative to the first sample of the record (O(log segments))
+    error::enmErrorType
+        getSampleTimeUs(
+            stcConfigFileType const& stcCfg,
+            uint64_t const u64SampleIdx,
+            float64_t& f64TimeUsOut
+        );
+
+    // Index of the first sample at or after a time relative to the first sample of the record
+    // (`u64TotalSamples` if the time is past the last sample) (O(log segments))
+    error::enmErrorType
+        getSampleIndexAtTime(
+            stcConfigFileType const& stcCfg,
+            float64_t const f64TimeUs,
+            uint64_t& u64SampleIdxOut
+        );
+
+    // Indices of samples whose digital state differs from the previous sample (rising and falling)
+    error::enmErrorType
+        getDigitalEdges(
+            stcDataFileType const& stcDat,
+            std::string_view const objSvChanName,
+            std::vector<uint64_t>& vctU64SampleIdxOut
+        );
+
+    // Index of the first sample at or after `u64FromSampleIdx` whose digital state differs from the
+    // previous sample (`u64TotalSamples` if the state never changes)
+    error::enmErrorType
+        findDigitalChange(
+            stcDataFileType const& stcDat,
+            std::string_view const objSvChanName,
+            uint64_t const u64FromSampleIdx,
+            uint64_t& u64SampleIdxOut
+        );
+
+    // Same as `findDigitalChange`, searching from the trigger sample
+    error::enmErrorType
+        findDigitalChangeAfterTrigger(
+            stcConfigFileType const& stcCfg,
+            stcDataFileType const& stcDat,
+            std::string_view const objSvChanName,
+            uint64_t& u64SampleIdxOut
+        );
+
+    // Number of samples in [u64BeginSampleIdx, u64EndSampleIdx) where the digital channel is set
+    error::enmErrorType
+        countDigitalSet(
+            stcDataFileType const& stcDat,
+            std::string_view const objSvChanName,
+            uint64_t const u64BeginSampleIdx,
+            uint64_t const u64EndSampleIdx,
+            uint64_t& u64CountOut
+        );
+
     error::enmErrorType
         printDataInfo(
             stcConfigFileType const& stcCfg,
@@ -0,0 +1,600 @@
+/**
+ * @file decode.cpp
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#include "decode.h"
+
+#include <cstring>
+#include <limits>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define DECODE_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC and Clang only emit instructions beyond the baseline target for functions that ask for them;
+// MSVC emits any intrinsic anywhere
+#if defined(DECODE_X86) && !defined(_MSC_VER)
+#define DECODE_TARGET_SSE2 __attribute__((target("sse2")))
+#define DECODE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define DECODE_TARGET_SSE2
+#define DECODE_TARGET_AVX2
+#endif
+
+namespace decode {
+
+    namespace {
+
+        // Private types
+
+        // (shared by the integer and single-precision scaling kernels)
+        typedef void (*fcnScaleI32ToF64Type)(
+            int32_t const* const ptrI32In,
+            size_t const sizCount,
+            float64_t const f64Mult,
+            float64_t const f64Offset,
+            float64_t* const ptrF64Out
+            );
+
+        // (each implementation adds the block to the running values in `stcReductionInOut`)
+        typedef void (*fcnReduceF64Type)(
+            float64_t const* const ptrF64In,
+            size_t const sizCount,
+            stcReductionType& stcReductionInOut
+            );
+
+        // Private functions
+
+        enmSimdLevelType
+            detectSimdLevel(
+                void
+            ) {
+#if defined(DECODE_X86) && defined(_MSC_VER)
+            int arrI32Regs[4] = {};
+            __cpuid(arrI32Regs, 0);
+            int const i32MaxLeaf = arrI32Regs[0];
+
+            __cpuid(arrI32Regs, 1);
+            bool const bSse2 = (0 != (arrI32Regs[3] & (1 << 26)));
+            bool const bOsXsave = (0 != (arrI32Regs[2] & (1 << 27)));
+            bool const bAvx = (0 != (arrI32Regs[2] & (1 << 28)));
+
+            bool bAvx2 = false;
+            if (bOsXsave && bAvx && (7 <= i32MaxLeaf)) {
+                // The OS must also save the upper halves of the YMM registers
+                bool const bOsYmm = (0x6 == (_xgetbv(0) & 0x6));
+                __cpuidex(arrI32Regs, 7, 0);
+                bAvx2 = bOsYmm && (0 != (arrI32Regs[1] & (1 << 5)));
+            }
+
+            if (bAvx2) {
+                return enmSimdLevelAvx2;
+            }
+            if (bSse2) {
+                return enmSimdLevelSse2;
+            }
+            return enmSimdLevelScalar;
+#elif defined(DECODE_X86)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) {
+                return enmSimdLevelAvx2;
+            }
+            if (__builtin_cpu_supports("sse2")) {
+                return enmSimdLevelSse2;
+            }
+            return enmSimdLevelScalar;
+#else
+            return enmSimdLevelScalar;
+#endif
+        }
+
+        void
+            scaleI32ToF64Scalar(
+                int32_t const* const ptrI32In,
+                size_t const sizCount,
+                float64_t const f64Mult,
+                float64_t const f64Offset,
+                float64_t* const ptrF64Out
+            ) {
+            for (size_t sizIdx = 0; sizCount > sizIdx; ++sizIdx) {
+                ptrF64Out[sizIdx] = ((f64Mult * ptrI32In[sizIdx]) + f64Offset);
+            }
+        }
+
+        void
+            scaleF32BitsToF64Scalar(
+                int32_t const* const ptrI32In,
+                size_t const sizCount,
+                float64_t const f64Mult,
+                float64_t const f64Offset,
+                float64_t* const ptrF64Out
+            ) {
+            for (size_t sizIdx = 0; sizCount > sizIdx; ++sizIdx) {
+                float32_t f32Data = 0.0f;
+                std::memcpy(&f32Data, (ptrI32In + sizIdx), sizeof(float32_t));
+                ptrF64Out[sizIdx] = ((f64Mult * f32Data) + f64Offset);
+            }
+        }
+
+        void
+            reduceF64Scalar(
+                float64_t const* const ptrF64In,
+                size_t const sizCount,
+                stcReductionType& stcReductionInOut
+            ) {
+            for (size_t sizIdx = 0; sizCount > sizIdx; ++sizIdx) {
+                float64_t const f64Data = ptrF64In[sizIdx];
+                stcReductionInOut.f64Min = (f64Data < stcReductionInOut.f64Min) ? f64Data : stcReductionInOut.f64Min;
+                stcReductionInOut.f64Max = (f64Data > stcReductionInOut.f64Max) ? f64Data : stcReductionInOut.f64Max;
+                stcReductionInOut.f64Sum += f64Data;
+                stcReductionInOut.f64SumSquares += (f64Data * f64Data);
+            }
+        }
+
+#if defined(DECODE_X86)
+        DECODE_TARGET_SSE2 void
+            scaleI32ToF64Sse2(
+                int32_t const* const ptrI32In,
+                size_t const sizCount,
+                float64_t const f64Mult,
+                float64_t const f64Offset,
+                float64_t* const ptrF64Out
+            ) {
+            __m128d const objMult = _mm_set1_pd(f64Mult);
+            __m128d const objOffset = _mm_set1_pd(f64Offset);
+
+            // 8 samples per iteration
+            size_t sizIdx = 0;
+            for (; sizCount >= (sizIdx + 8); sizIdx += 8) {
+                __m128i const objI32Lo = _mm_loadu_si128(reinterpret_cast<__m128i const*>(ptrI32In + sizIdx + 0));
+                __m128i const objI32Hi = _mm_loadu_si128(reinterpret_cast<__m128i const*>(ptrI32In + sizIdx + 4));
+
+                __m128d const objF64A = _mm_cvtepi32_pd(objI32Lo);
+                __m128d const objF64B = _mm_cvtepi32_pd(_mm_srli_si128(objI32Lo, 8));
+                __m128d const objF64C = _mm_cvtepi32_pd(objI32Hi);
+                __m128d const objF64D = _mm_cvtepi32_pd(_mm_srli_si128(objI32Hi, 8));
+
+                _mm_storeu_pd(ptrF64Out + sizIdx + 0, _mm_add_pd(_mm_mul_pd(objF64A, objMult), objOffset));
+                _mm_storeu_pd(ptrF64Out + sizIdx + 2, _mm_add_pd(_mm_mul_pd(objF64B, objMult), objOffset));
+                _mm_storeu_pd(ptrF64Out + sizIdx + 4, _mm_add_pd(_mm_mul_pd(objF64C, objMult), objOffset));
+                _mm_storeu_pd(ptrF64Out + sizIdx + 6, _mm_add_pd(_mm_mul_pd(objF64D, objMult), objOffset));
+            }
+
+            // Remainder
+            scaleI32ToF64Scalar(
+                (ptrI32In + sizIdx),
+                (sizCount - sizIdx),
+                f64Mult,
+                f64Offset,
+                (ptrF64Out + sizIdx)
+            );
+        }
+
+        DECODE_TARGET_AVX2 void
+            scaleI32ToF64Avx2(
+                int32_t const* const ptrI32In,
+                size_t const sizCount,
+                float64_t const f64Mult,
+                float64_t const f64Offset,
+                float64_t* const ptrF64Out
+            ) {
+            __m256d const objMult = _mm256_set1_pd(f64Mult);
+            __m256d const objOffset = _mm256_set1_pd(f64Offset);
+
+            // 16 samples per iteration
+            size_t sizIdx = 0;
+            for (; sizCount >= (sizIdx + 16); sizIdx += 16) {
+                __m256i const objI32Lo = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptrI32In + sizIdx + 0));
+                __m256i const objI32Hi = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptrI32In + sizIdx + 8));
+
+                __m256d const objF64A = _mm256_cvtepi32_pd(_mm256_castsi256_si128(objI32Lo));
+                __m256d const objF64B = _mm256_cvtepi32_pd(_mm256_extracti128_si256(objI32Lo, 1));
+                __m256d const objF64C = _mm256_cvtepi32_pd(_mm256_castsi256_si128(objI32Hi));
+                __m256d const objF64D = _mm256_cvtepi32_pd(_mm256_extracti128_si256(objI32Hi, 1));
+
+                _mm256_storeu_pd(ptrF64Out + sizIdx + 0, _mm256_add_pd(_mm256_mul_pd(objF64A, objMult), objOffset));
+                _mm256_storeu_pd(ptrF64Out + sizIdx + 4, _mm256_add_pd(_mm256_mul_pd(objF64B, objMult), objOffset));
+                _mm256_storeu_pd(ptrF64Out + sizIdx + 8, _mm256_add_pd(_mm256_mul_pd(objF64C, objMult), objOffset));
+                _mm256_storeu_pd(ptrF64Out + sizIdx + 12, _mm256_add_pd(_mm256_mul_pd(objF64D, objMult), objOffset));
+            }
+
+            // Remainder
+            scaleI32ToF64Scalar(
+                (ptrI32In + sizIdx),
+                (sizCount - sizIdx),
+                f64Mult,
+                f64Offset,
+                (ptrF64Out + sizIdx)
+            );
+        }
+
+        DECODE_TARGET_SSE2 void
+            scaleF32BitsToF64Sse2(
+                int32_t const* const ptrI32In,
+                size_t const sizCount,
+                float64_t const f64Mult,
+                float64_t const f64Offset,
+                float64_t* const ptrF64Out
+            ) {
+            __m128d const objMult = _mm_set1_pd(f64Mult);
+            __m128d const objOffset = _mm_set1_pd(f64Offset);
+
+            // 8 samples per iteration
+            size_t sizIdx = 0;
+            for (; sizCount >= (sizIdx + 8); sizIdx += 8) {
+                __m128 const objF32Lo = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ptrI32In + sizIdx + 0)));
+                __m128 const objF32Hi = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ptrI32In + sizIdx + 4)));
+
+                __m128d const objF64A = _mm_cvtps_pd(objF32Lo);
+                __m128d const objF64B = _mm_cvtps_pd(_mm_movehl_ps(objF32Lo, objF32Lo));
+                __m128d const objF64C = _mm_cvtps_pd(objF32Hi);
+                __m128d const objF64D = _mm_cvtps_pd(_mm_movehl_ps(objF32Hi, objF32Hi));
+
+                _mm_storeu_pd(ptrF64Out + sizIdx + 0, _mm_add_pd(_mm_mul_pd(objF64A, objMult), objOffset));
+                _mm_storeu_pd(ptrF64Out + sizIdx + 2, _mm_add_pd(_mm_mul_pd(objF64B, objMult), objOffset));
+                _mm_storeu_pd(ptrF64Out + sizIdx + 4, _mm_add_pd(_mm_mul_pd(objF64C, objMult), objOffset));
+                _mm_storeu_pd(ptrF64Out + sizIdx + 6, _mm_add_pd(_mm_mul_pd(objF64D, objMult), objOffset));
+            }
+
+            // Remainder
+            scaleF32BitsToF64Scalar(
+                (ptrI32In + sizIdx),
+                (sizCount - sizIdx),
+                f64Mult,
+                f64Offset,
+                (ptrF64Out + sizIdx)
+            );
+        }
+
+        DECODE_TARGET_AVX2 void
+            scaleF32BitsToF64Avx2(
+                int32_t const* const ptrI32In,
+                size_t const sizCount,
+                float64_t const f64Mult,
+                float64_t const f64Offset,
+                float64_t* const ptrF64Out
+            ) {
+            __m256d const objMult = _mm256_set1_pd(f64Mult);
+            __m256d const objOffset = _mm256_set1_pd(f64Offset);
+
+            // 16 samples per iteration
+            size_t sizIdx = 0;
+            for (; sizCount >= (sizIdx + 16); sizIdx += 16) {
+                __m256 const objF32Lo = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptrI32In + sizIdx + 0)));
+                __m256 const objF32Hi = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptrI32In + sizIdx + 8)));
+
+                __m256d const objF64A = _mm256_cvtps_pd(_mm256_castps256_ps128(objF32Lo));
+                __m256d const objF64B = _mm256_cvtps_pd(_mm256_extractf128_ps(objF32Lo, 1));
+                __m256d const objF64C = _mm256_cvtps_pd(_mm256_castps256_ps128(objF32Hi));
+                __m256d const objF64D = _mm256_cvtps_pd(_mm256_extractf128_ps(objF32Hi, 1));
+
+                _mm256_storeu_pd(ptrF64Out + sizIdx + 0, _mm256_add_pd(_mm256_mul_pd(objF64A, objMult), objOffset));
+                _mm256_storeu_pd(ptrF64Out + sizIdx + 4, _mm256_add_pd(_mm256_mul_pd(objF64B, objMult), objOffset));
+                _mm256_storeu_pd(ptrF64Out + sizIdx + 8, _mm256_add_pd(_mm256_mul_pd(objF64C, objMult), objOffset));
+                _mm256_storeu_pd(ptrF64Out + sizIdx + 12, _mm256_add_pd(_mm256_mul_pd(objF64D, objMult), objOffset));
+            }
+
+            // Remainder
+            scaleF32BitsToF64Scalar(
+                (ptrI32In + sizIdx),
+                (sizCount - sizIdx),
+                f64Mult,
+                f64Offset,
+                (ptrF64Out + sizIdx)
+            );
+        }
+
+        DECODE_TARGET_SSE2 void
+            reduceF64Sse2(
+                float64_t const* const ptrF64In,
+                size_t const sizCount,
+                stcReductionType& stcReductionInOut
+            ) {
+            // Two independent sets of accumulators (hides the latency of the additions)
+            __m128d objMinA = _mm_set1_pd(stcReductionInOut.f64Min);
+            __m128d objMaxA = _mm_set1_pd(stcReductionInOut.f64Max);
+            __m128d objSumA = _mm_setzero_pd();
+            __m128d objSumSqA = _mm_setzero_pd();
+            __m128d objMinB = objMinA;
+            __m128d objMaxB = objMaxA;
+            __m128d objSumB = _mm_setzero_pd();
+            __m128d objSumSqB = _mm_setzero_pd();
+
+            // 4 samples per iteration
+            size_t sizIdx = 0;
+            for (; sizCount >= (sizIdx + 4); sizIdx += 4) {
+                __m128d const objF64A = _mm_loadu_pd(ptrF64In + sizIdx + 0);
+                __m128d const objF64B = _mm_loadu_pd(ptrF64In + sizIdx + 2);
+
+                objMinA = _mm_min_pd(objMinA, objF64A);
+                objMaxA = _mm_max_pd(objMaxA, objF64A);
+                objSumA = _mm_add_pd(objSumA, objF64A);
+                objSumSqA = _mm_add_pd(objSumSqA, _mm_mul_pd(objF64A, objF64A));
+                objMinB = _mm_min_pd(objMinB, objF64B);
+                objMaxB = _mm_max_pd(objMaxB, objF64B);
+                objSumB = _mm_add_pd(objSumB, objF64B);
+                objSumSqB = _mm_add_pd(objSumSqB, _mm_mul_pd(objF64B, objF64B));
+            }
+
+            // Combine lanes
+            alignas(16) float64_t arrF64Min[2];
+            alignas(16) float64_t arrF64Max[2];
+            alignas(16) float64_t arrF64Sum[2];
+            alignas(16) float64_t arrF64SumSq[2];
+            _mm_store_pd(arrF64Min, _mm_min_pd(objMinA, objMinB));
+            _mm_store_pd(arrF64Max, _mm_max_pd(objMaxA, objMaxB));
+            _mm_store_pd(arrF64Sum, _mm_add_pd(objSumA, objSumB));
+            _mm_store_pd(arrF64SumSq, _mm_add_pd(objSumSqA, objSumSqB));
+            stcReductionInOut.f64Min = (arrF64Min[0] < arrF64Min[1]) ? arrF64Min[0] : arrF64Min[1];
+            stcReductionInOut.f64Max = (arrF64Max[0] > arrF64Max[1]) ? arrF64Max[0] : arrF64Max[1];
+            stcReductionInOut.f64Sum += (arrF64Sum[0] + arrF64Sum[1]);
+            stcReductionInOut.f64SumSquares += (arrF64SumSq[0] + arrF64SumSq[1]);
+
+            // Remainder
+            reduceF64Scalar(
+                (ptrF64In + sizIdx),
+                (sizCount - sizIdx),
+                stcReductionInOut
+            );
+        }
+
+        DECODE_TARGET_AVX2 void
+            reduceF64Avx2(
+                float64_t const* const ptrF64In,
+                size_t const sizCount,
+                stcReductionType& stcReductionInOut
+            ) {
+            // Two independent sets of accumulators (hides the latency of the additions)
+            __m256d objMinA = _mm256_set1_pd(stcReductionInOut.f64Min);
+            __m256d objMaxA = _mm256_set1_pd(stcReductionInOut.f64Max);
+            __m256d objSumA = _mm256_setzero_pd();
+            __m256d objSumSqA = _mm256_setzero_pd();
+            __m256d objMinB = objMinA;
+            __m256d objMaxB = objMaxA;
+            __m256d objSumB = _mm256_setzero_pd();
+            __m256d objSumSqB = _mm256_setzero_pd();
+
+            // 8 samples per iteration
+            size_t sizIdx = 0;
+            for (; sizCount >= (sizIdx + 8); sizIdx += 8) {
+                __m256d const objF64A = _mm256_loadu_pd(ptrF64In + sizIdx + 0);
+                __m256d const objF64B = _mm256_loadu_pd(ptrF64In + sizIdx + 4);
+
+                objMinA = _mm256_min_pd(objMinA, objF64A);
+                objMaxA = _mm256_max_pd(objMaxA, objF64A);
+                objSumA = _mm256_add_pd(objSumA, objF64A);
+                objSumSqA = _mm256_add_pd(objSumSqA, _mm256_mul_pd(objF64A, objF64A));
+                objMinB = _mm256_min_pd(objMinB, objF64B);
+                objMaxB = _mm256_max_pd(objMaxB, objF64B);
+                objSumB = _mm256_add_pd(objSumB, objF64B);
+                objSumSqB = _mm256_add_pd(objSumSqB, _mm256_mul_pd(objF64B, objF64B));
+            }
+
+            // Combine lanes
+            alignas(32) float64_t arrF64Min[4];
+            alignas(32) float64_t arrF64Max[4];
+            alignas(32) float64_t arrF64Sum[4];
+            alignas(32) float64_t arrF64SumSq[4];
+            _mm256_store_pd(arrF64Min, _mm256_min_pd(objMinA, objMinB));
+            _mm256_store_pd(arrF64Max, _mm256_max_pd(objMaxA, objMaxB));
+            _mm256_store_pd(arrF64Sum, _mm256_add_pd(objSumA, objSumB));
+            _mm256_store_pd(arrF64SumSq, _mm256_add_pd(objSumSqA, objSumSqB));
+            for (size_t sizLane = 0; 4 > sizLane; ++sizLane) {
+                stcReductionInOut.f64Min = (arrF64Min[sizLane] < stcReductionInOut.f64Min) ? arrF64Min[sizLane] : stcReductionInOut.f64Min;
+                stcReductionInOut.f64Max = (arrF64Max[sizLane] > stcReductionInOut.f64Max) ? arrF64Max[sizLane] : stcReductionInOut.f64Max;
+            }
+            stcReductionInOut.f64Sum += ((arrF64Sum[0] + arrF64Sum[1]) + (arrF64Sum[2] + arrF64Sum[3]));
+            stcReductionInOut.f64SumSquares += ((arrF64SumSq[0] + arrF64SumSq[1]) + (arrF64SumSq[2] + arrF64SumSq[3]));
+
+            // Remainder
+            reduceF64Scalar(
+                (ptrF64In + sizIdx),
+                (sizCount - sizIdx),
+                stcReductionInOut
+            );
+        }
+#endif
+
+        fcnScaleI32ToF64Type
+            selectScaleI32ToF64(
+                void
+            ) {
+            switch (getSimdLevel()) {
+#if defined(DECODE_X86)
+            case enmSimdLevelAvx2: {
+                return scaleI32ToF64Avx2;
+            }
+            case enmSimdLevelSse2: {
+                return scaleI32ToF64Sse2;
+            }
+#endif
+            default: {
+                return scaleI32ToF64Scalar;
+            }
+            }
+        }
+
+        fcnScaleI32ToF64Type
+            selectScaleF32BitsToF64(
+                void
+            ) {
+            switch (getSimdLevel()) {
+#if defined(DECODE_X86)
+            case enmSimdLevelAvx2: {
+                return scaleF32BitsToF64Avx2;
+            }
+            case enmSimdLevelSse2: {
+                return scaleF32BitsToF64Sse2;
+            }
+#endif
+            default: {
+                return scaleF32BitsToF64Scalar;
+            }
+            }
+        }
+
+        fcnReduceF64Type
+            selectReduceF64(
+                void
+            ) {
+            switch (getSimdLevel()) {
+#if defined(DECODE_X86)
+            case enmSimdLevelAvx2: {
+                return reduceF64Avx2;
+            }
+            case enmSimdLevelSse2: {
+                return reduceF64Sse2;
+            }
+#endif
+            default: {
+                return reduceF64Scalar;
+            }
+            }
+        }
+    }
+
+    enmSimdLevelType
+        getSimdLevel(
+            void
+        ) {
+        static enmSimdLevelType const enmSimdLevel = detectSimdLevel();
+        return enmSimdLevel;
+    }
+
+    void
+        gatherI16Le(
+            char const* const ptrChrBase,
+            size_t const sizStrideBytes,
+            size_t const sizCount,
+            int32_t* const ptrI32Out
+        ) {
+        char const* ptrChrAt = ptrChrBase;
+        if constexpr (bHostLittleEndian) {
+            // Unaligned native load (compiles to a single sign-extending move)
+            for (size_t sizIdx = 0; sizCount > sizIdx; ++sizIdx) {
+                int16_t i16Data = 0;
+                std::memcpy(&i16Data, ptrChrAt, sizeof(int16_t));
+                ptrI32Out[sizIdx] = i16Data;
+                ptrChrAt += sizStrideBytes;
+            }
+        }
+        else {
+            for (size_t sizIdx = 0; sizCount > sizIdx; ++sizIdx) {
+                uint16_t const u16Data = static_cast<uint16_t>(
+                    (static_cast<uint8_t>(ptrChrAt[1]) << 8) |
+                    (static_cast<uint8_t>(ptrChrAt[0]) << 0)
+                    );
+                ptrI32Out[sizIdx] = static_cast<int16_t>(u16Data);
+                ptrChrAt += sizStrideBytes;
+            }
+        }
+    }
+
+    void
+        gatherI32Le(
+            char const* const ptrChrBase,
+            size_t const sizStrideBytes,
+            size_t const sizCount,
+            int32_t* const ptrI32Out
+        ) {
+        char const* ptrChrAt = ptrChrBase;
+        if constexpr (bHostLittleEndian) {
+            // Unaligned native load
+            for (size_t sizIdx = 0; sizCount > sizIdx; ++sizIdx) {
+                std::memcpy((ptrI32Out + sizIdx), ptrChrAt, sizeof(int32_t));
+                ptrChrAt += sizStrideBytes;
+            }
+        }
+        else {
+            for (size_t sizIdx = 0; sizCount > sizIdx; ++sizIdx) {
+                uint32_t const u32Data = (
+                    (static_cast<uint32_t>(static_cast<uint8_t>(ptrChrAt[3])) << 24) |
+                    (static_cast<uint32_t>(static_cast<uint8_t>(ptrChrAt[2])) << 16) |
+                    (static_cast<uint32_t>(static_cast<uint8_t>(ptrChrAt[1])) << 8) |
+                    (static_cast<uint32_t>(static_cast<uint8_t>(ptrChrAt[0])) << 0)
+                    );
+                ptrI32Out[sizIdx] = static_cast<int32_t>(u32Data);
+                ptrChrAt += sizStrideBytes;
+            }
+        }
+    }
+
+    void
+        gatherBitsU16Le(
+            char const* const ptrChrBase,
+            size_t const sizStrideBytes,
+            size_t const sizCount,
+            size_t const sizNumBits,
+            uint64_t* const* const ptrPtrU64Out
+        ) {
+        uint16_t arrU16Words[64] = {};
+
+        char const* ptrChrAt = ptrChrBase;
+        for (size_t sizWordIdx = 0; sizCount > (64 * sizWordIdx); ++sizWordIdx) {
+            // Load up to 64 status words
+            size_t const sizNumRows = ((sizCount - (64 * sizWordIdx)) < 64) ? (sizCount - (64 * sizWordIdx)) : 64;
+            for (size_t sizRow = 0; sizNumRows > sizRow; ++sizRow) {
+                arrU16Words[sizRow] = static_cast<uint16_t>(
+                    (static_cast<uint8_t>(ptrChrAt[1]) << 8) |
+                    (static_cast<uint8_t>(ptrChrAt[0]) << 0)
+                    );
+                ptrChrAt += sizStrideBytes;
+            }
+
+            // Collect each bit position across the loaded words
+            for (size_t sizBit = 0; sizNumBits > sizBit; ++sizBit) {
+                uint64_t u64Bits = 0;
+                for (size_t sizRow = 0; sizNumRows > sizRow; ++sizRow) {
+                    u64Bits |= (static_cast<uint64_t>((arrU16Words[sizRow] >> sizBit) & 1) << sizRow);
+                }
+                ptrPtrU64Out[sizBit][sizWordIdx] = u64Bits;
+            }
+        }
+    }
+
+    void
+        scaleI32ToF64(
+            int32_t const* const ptrI32In,
+            size_t const sizCount,
+            float64_t const f64Mult,
+            float64_t const f64Offset,
+            float64_t* const ptrF64Out
+        ) {
+        static fcnScaleI32ToF64Type const fcnScale = selectScaleI32ToF64();
+        fcnScale(ptrI32In, sizCount, f64Mult, f64Offset, ptrF64Out);
+    }
+
+    void
+        scaleF32BitsToF64(
+            int32_t const* const ptrI32In,
+            size_t const sizCount,
+            float64_t const f64Mult,
+            float64_t const f64Offset,
+            float64_t* const ptrF64Out
+        ) {
+        static fcnScaleI32ToF64Type const fcnScale = selectScaleF32BitsToF64();
+        fcnScale(ptrI32In, sizCount, f64Mult, f64Offset, ptrF64Out);
+    }
+
+    void
+        reduceF64(
+            float64_t const* const ptrF64In,
+            size_t const sizCount,
+            stcReductionType& stcReductionOut
+        ) {
+        static fcnReduceF64Type const fcnReduce = selectReduceF64();
+        stcReductionOut.f64Min = std::numeric_limits<float64_t>::infinity();
+        stcReductionOut.f64Max = -std::numeric_limits<float64_t>::infinity();
+        stcReductionOut.f64Sum = 0.0;
+        stcReductionOut.f64SumSquares = 0.0;
+        fcnReduce(ptrF64In, sizCount, stcReductionOut);
+    }
+
+}
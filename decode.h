@@ -0,0 +1,170 @@
+/**
+ * @file decode.h
+ * @brief Vectorized kernels for decoding raw sample values into engineering units and reducing them.
+ *
+ * The widest instruction set supported by the host (AVX2, SSE2, or plain scalar code) is detected
+ * once at runtime, and every kernel call is dispatched to the matching implementation.
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+#include "types.h"
+
+namespace decode {
+
+    enum enmSimdLevelType {
+        enmSimdLevelScalar,
+        enmSimdLevelSse2,
+        enmSimdLevelAvx2,
+
+        enmSimdLevelTypeCount
+    };
+
+    // Byte order of the target (others are handled with portable shifts)
+    constexpr bool bHostLittleEndian =
+#if defined(_M_X64) || defined(_M_IX86) || defined(_M_ARM64) \
+    || (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__))
+        true;
+#else
+        false;
+#endif
+
+    // Load one little-endian field from an unaligned address (inline, for decoders that unroll
+    // over the fields of a record)
+    inline uint32_t
+        loadU32Le(
+            char const* const ptrChrIn
+        ) {
+        if constexpr (bHostLittleEndian) {
+            uint32_t u32Data = 0;
+            std::memcpy(&u32Data, ptrChrIn, sizeof(uint32_t));
+            return u32Data;
+        }
+        else {
+            return (
+                (static_cast<uint32_t>(static_cast<uint8_t>(ptrChrIn[3])) << 24) |
+                (static_cast<uint32_t>(static_cast<uint8_t>(ptrChrIn[2])) << 16) |
+                (static_cast<uint32_t>(static_cast<uint8_t>(ptrChrIn[1])) << 8) |
+                (static_cast<uint32_t>(static_cast<uint8_t>(ptrChrIn[0])) << 0)
+                );
+        }
+    }
+
+    // (sign-extended)
+    inline int32_t
+        loadI16Le(
+            char const* const ptrChrIn
+        ) {
+        if constexpr (bHostLittleEndian) {
+            int16_t i16Data = 0;
+            std::memcpy(&i16Data, ptrChrIn, sizeof(int16_t));
+            return i16Data;
+        }
+        else {
+            return static_cast<int16_t>(
+                (static_cast<uint16_t>(static_cast<uint8_t>(ptrChrIn[1])) << 8) |
+                (static_cast<uint16_t>(static_cast<uint8_t>(ptrChrIn[0])) << 0)
+                );
+        }
+    }
+
+    inline int32_t
+        loadI32Le(
+            char const* const ptrChrIn
+        ) {
+        return static_cast<int32_t>(loadU32Le(ptrChrIn));
+    }
+
+    // Widest instruction set usable on this host (detected on first call)
+    enmSimdLevelType
+        getSimdLevel(
+            void
+        );
+
+    // Copy one little-endian `int16_t` column out of a table of fixed-size records (sign-extended)
+    //
+    //     ptrI32Out[n] = int16 at (ptrChrBase + (n * sizStrideBytes))
+    void
+        gatherI16Le(
+            char const* const ptrChrBase,
+            size_t const sizStrideBytes,
+            size_t const sizCount,
+            int32_t* const ptrI32Out
+        );
+
+    // Copy one little-endian 32-bit column out of a table of fixed-size records (an `int32_t` for
+    // BINARY32, the IEEE 754 bits of a `float` for FLOAT32)
+    //
+    //     ptrI32Out[n] = int32 at (ptrChrBase + (n * sizStrideBytes))
+    void
+        gatherI32Le(
+            char const* const ptrChrBase,
+            size_t const sizStrideBytes,
+            size_t const sizCount,
+            int32_t* const ptrI32Out
+        );
+
+    // Transpose one little-endian 16-bit status word column out of a table of fixed-size records
+    // into packed per-channel bitsets (bit `b` of record `n` --> bit `n` of bitset `b`)
+    //
+    // Writes `sizNumBits` (at most 16) bitsets through `ptrPtrU64Out`, each starting at the word that
+    // holds record 0 (so the first record must fall on a 64-record boundary of the bitset)
+    void
+        gatherBitsU16Le(
+            char const* const ptrChrBase,
+            size_t const sizStrideBytes,
+            size_t const sizCount,
+            size_t const sizNumBits,
+            uint64_t* const* const ptrPtrU64Out
+        );
+
+    // Scale a contiguous block of raw values into engineering units
+    //
+    //     ptrF64Out[n] = (f64Mult * ptrI32In[n]) + f64Offset
+    void
+        scaleI32ToF64(
+            int32_t const* const ptrI32In,
+            size_t const sizCount,
+            float64_t const f64Mult,
+            float64_t const f64Offset,
+            float64_t* const ptrF64Out
+        );
+
+    // Scale a contiguous block of raw single-precision values (IEEE 754 bits, as gathered by
+    // `gatherI32Le`) into engineering units
+    //
+    //     ptrF64Out[n] = (f64Mult * float(ptrI32In[n])) + f64Offset
+    void
+        scaleF32BitsToF64(
+            int32_t const* const ptrI32In,
+            size_t const sizCount,
+            float64_t const f64Mult,
+            float64_t const f64Offset,
+            float64_t* const ptrF64Out
+        );
+
+    // Extremes and sums of a block of values
+    struct stcReductionType {
+        float64_t f64Min;
+        float64_t f64Max;
+        float64_t f64Sum;
+        float64_t f64SumSquares;
+    };
+
+    // Reduce a contiguous block of values (an empty block gives min +inf, max -inf, and zero sums)
+    //
+    //     min(ptrF64In[n]), max(ptrF64In[n]), sum(ptrF64In[n]), sum(ptrF64In[n] * ptrF64In[n])
+    void
+        reduceF64(
+            float64_t const* const ptrF64In,
+            size_t const sizCount,
+            stcReductionType& stcReductionOut
+        );
+
+}
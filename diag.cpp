@@ -0,0 +1,99 @@
+/**
+ * @file diag.cpp
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#include "diag.h"
+
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <utility>
+
+namespace diag {
+
+    namespace {
+
+        std::mutex objMtxSink;
+        fcnSinkType fcnCurrentSink;
+        enmLevelType enmCurrentLevel = enmLevelInfo;
+
+        // Lowest level that reaches a sink (`enmLevelOff` without one), so filtering is one load
+        std::atomic<int> atmIntEnabledLevel{ static_cast<int>(enmLevelOff) };
+
+        void
+            updateEnabledLevel(
+                void
+            ) {
+            atmIntEnabledLevel.store(
+                static_cast<int>(fcnCurrentSink ? enmCurrentLevel : enmLevelOff),
+                std::memory_order_relaxed
+            );
+        }
+
+    }
+
+    void
+        setSink(
+            fcnSinkType fcnSink
+        ) {
+        std::lock_guard<std::mutex> objLock(objMtxSink);
+        fcnCurrentSink = std::move(fcnSink);
+        updateEnabledLevel();
+    }
+
+    void
+        setLevel(
+            enmLevelType const enmLevel
+        ) {
+        std::lock_guard<std::mutex> objLock(objMtxSink);
+        enmCurrentLevel = enmLevel;
+        updateEnabledLevel();
+    }
+
+    bool
+        isEnabled(
+            enmLevelType const enmLevel
+        ) {
+        return (
+            (enmLevelOff > enmLevel)
+            && (atmIntEnabledLevel.load(std::memory_order_relaxed) <= static_cast<int>(enmLevel))
+            );
+    }
+
+    void
+        write(
+            enmLevelType const enmLevel,
+            std::string_view const objSvMessage
+        ) {
+        std::lock_guard<std::mutex> objLock(objMtxSink);
+        if (fcnCurrentSink && (enmCurrentLevel <= enmLevel) && (enmLevelOff > enmLevel)) {
+            fcnCurrentSink(enmLevel, objSvMessage);
+        }
+    }
+
+    void
+        writeToConsole(
+            enmLevelType const enmLevel,
+            std::string_view const objSvMessage
+        ) {
+        switch (enmLevel) {
+        case enmLevelDebug:
+            std::cerr << ". . . DEBUG . . . ";
+            break;
+        case enmLevelInfo:
+            std::cerr << "? ? ? INFO ? ? ? ";
+            break;
+        case enmLevelWarning:
+            std::cerr << "* * * WARNING * * * ";
+            break;
+        default:
+            std::cerr << "! ! ! ERROR ! ! ! ";
+            break;
+        }
+        std::cerr << objSvMessage << '\n';
+    }
+
+}
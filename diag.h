@@ -0,0 +1,80 @@
+/**
+ * @file diag.h
+ * @brief Pluggable diagnostics sink with a level filter.
+ *
+ * The library never writes to the console itself. Messages go to a sink installed by the
+ * application (none by default), and only if they are at or above the runtime level; a message
+ * that is filtered out is never formatted. Levels below `DIAG_COMPILED_LEVEL` are removed at
+ * compile time, so e.g. building with `DIAG_COMPILED_LEVEL=4` leaves no diagnostics code at all.
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#pragma once
+
+#include <functional>
+#include <string_view>
+
+namespace diag {
+
+    enum enmLevelType {
+        enmLevelDebug,
+        enmLevelInfo,
+        enmLevelWarning,
+        enmLevelError,
+        enmLevelOff,
+
+        enmLevelTypeCount
+    };
+
+    // Receives each message that passes the filter (calls are serialized, so a sink need not lock)
+    typedef std::function<void(enmLevelType, std::string_view)> fcnSinkType;
+
+    // Install the sink (an empty function removes it, silencing every message)
+    void
+        setSink(
+            fcnSinkType fcnSink
+        );
+
+    // Lowest level passed to the sink (`enmLevelInfo` by default)
+    void
+        setLevel(
+            enmLevelType const enmLevel
+        );
+
+    // Whether a message at `enmLevel` would reach a sink
+    bool
+        isEnabled(
+            enmLevelType const enmLevel
+        );
+
+    void
+        write(
+            enmLevelType const enmLevel,
+            std::string_view const objSvMessage
+        );
+
+    // Ready-made sink writing "? ? ? INFO ? ? ? message" style lines to standard error
+    void
+        writeToConsole(
+            enmLevelType const enmLevel,
+            std::string_view const objSvMessage
+        );
+
+}
+
+// Lowest level compiled in (0 --> debug ... 4 --> nothing)
+#ifndef DIAG_COMPILED_LEVEL
+#define DIAG_COMPILED_LEVEL 0
+#endif
+
+// Send a message to the sink; the message expression is only evaluated if it would be delivered
+#define DIAG_LOG(enmLevel, ...) \
+    do { \
+        if constexpr (static_cast<int>(enmLevel) >= DIAG_COMPILED_LEVEL) { \
+            if (diag::isEnabled(enmLevel)) { \
+                diag::write((enmLevel), (__VA_ARGS__)); \
+            } \
+        } \
+    } while (false)
@@ -7,23 +7,22 @@
 
 #include "error.h"
 
-#include <iostream>
-#include <vector>
+#include "diag.h"
 
 namespace error {
 
-    enmErrorType
-        printCodeIfError(
+    char const*
+        getMessage(
             enmErrorType const enmErrCode
         ) {
         if (
             (0 > enmErrCode)
             || (enmErrorTypeCount <= enmErrCode)
             ) {
-            std::cerr << "Invalid error code." << std::endl;
+            return "Invalid error code.";
         }
 
-        static std::vector<std::string> const vctStrMessages = {
+        static char const* const arrPtrChrMessages[enmErrorTypeCount] = {
             // enmErrorNone
             "No error.",
             // enmErrorInvalidArg
@@ -33,14 +32,20 @@ namespace error {
             // enmErrorNotImpl
             "Feature not implemented.",
             // emErrorOutOfOrder
-            "Sequence out of order."
+            "Sequence out of order.",
+            // enmErrorFileSize
+            "File size does not match configuration."
         };
+        return arrPtrChrMessages[enmErrCode];
+    }
 
+    enmErrorType
+        printCodeIfError(
+            enmErrorType const enmErrCode
+        ) {
         if (enmErrorNone != enmErrCode) {
-            std::cerr << "! ! ! ERROR ! ! ! " << vctStrMessages[static_cast<size_t>(enmErrCode)]
-                << std::endl;
+            DIAG_LOG(diag::enmLevelError, getMessage(enmErrCode));
         }
-
         return enmErrCode;
     }
 }
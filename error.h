@@ -16,10 +16,18 @@ namespace error {
         enmErrorFileDne,
         enmErrorNotImpl,
         emErrorOutOfOrder,
+        enmErrorFileSize,
 
         enmErrorTypeCount
     };
 
+    // Human-readable description of an error code
+    char const*
+        getMessage(
+            enmErrorType const enmErrCode
+        );
+
+    // Report an error code (other than `enmErrorNone`) to the diagnostics sink at error level
     enmErrorType
         printCodeIfError(
             enmErrorType const enmErrCode
@@ -8,6 +8,7 @@
 #include <string>
 
 #include "comtrade.h"
+#include "diag.h"
 #include "error.h"
 #include "types.h"
 #include "utils.h"
@@ -26,6 +27,9 @@ main(
     std::string const strFileNamePrefix
         = "C:/path/to/file";
 
+    // The library is silent unless a diagnostics sink is installed
+    diag::setSink(diag::writeToConsole);
+
     /* Parse configuration file */
     comtrade::stcConfigFileType stcCfg{};
     error::enmErrorType enmErrParse = comtrade::parseConfigFile(
@@ -0,0 +1,180 @@
+/**
+ * @file mappedFile.cpp
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#include "mappedFile.h"
+
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mf {
+
+    clsMappedFile::clsMappedFile(
+        clsMappedFile&& objMfOther
+    ) noexcept {
+        *this = std::move(objMfOther);
+    }
+
+    clsMappedFile&
+        clsMappedFile::operator=(
+            clsMappedFile&& objMfOther
+            ) noexcept {
+        if (this != &objMfOther) {
+            close();
+            std::swap(bIsOpen, objMfOther.bIsOpen);
+            std::swap(ptrChrData, objMfOther.ptrChrData);
+            std::swap(u64SizeBytes, objMfOther.u64SizeBytes);
+#if defined(_WIN32)
+            std::swap(ptrVoidFileHandle, objMfOther.ptrVoidFileHandle);
+            std::swap(ptrVoidMapHandle, objMfOther.ptrVoidMapHandle);
+#endif
+        }
+        return *this;
+    }
+
+    error::enmErrorType
+        clsMappedFile::open(
+            std::string const& strFileName
+        ) {
+        close();
+
+        if (strFileName.empty()) {
+            return error::enmErrorInvalidArg;
+        }
+
+#if defined(_WIN32)
+        HANDLE const objHdlFile = CreateFileA(
+            strFileName.c_str(),
+            GENERIC_READ,
+            FILE_SHARE_READ,
+            nullptr,
+            OPEN_EXISTING,
+            (FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN),
+            nullptr
+        );
+        if (INVALID_HANDLE_VALUE == objHdlFile) {
+            return error::enmErrorFileDne;
+        }
+
+        LARGE_INTEGER objLiSize{};
+        if (!GetFileSizeEx(objHdlFile, &objLiSize)) {
+            CloseHandle(objHdlFile);
+            return error::enmErrorFileDne;
+        }
+        u64SizeBytes = static_cast<uint64_t>(objLiSize.QuadPart);
+        ptrVoidFileHandle = objHdlFile;
+
+        // Zero-length files cannot be mapped, but are still valid (empty) files
+        if (0 < u64SizeBytes) {
+            HANDLE const objHdlMap = CreateFileMappingA(
+                objHdlFile,
+                nullptr,
+                PAGE_READONLY,
+                0,
+                0,
+                nullptr
+            );
+            if (nullptr == objHdlMap) {
+                close();
+                return error::enmErrorFileDne;
+            }
+            ptrVoidMapHandle = objHdlMap;
+
+            void const* const ptrVoidView = MapViewOfFile(
+                objHdlMap,
+                FILE_MAP_READ,
+                0,
+                0,
+                0
+            );
+            if (nullptr == ptrVoidView) {
+                close();
+                return error::enmErrorFileDne;
+            }
+            ptrChrData = static_cast<char const*>(ptrVoidView);
+        }
+#else
+        int const i32Fd = ::open(strFileName.c_str(), O_RDONLY);
+        if (0 > i32Fd) {
+            return error::enmErrorFileDne;
+        }
+
+        struct stat objStat {};
+        if (0 != ::fstat(i32Fd, &objStat)) {
+            ::close(i32Fd);
+            return error::enmErrorFileDne;
+        }
+        u64SizeBytes = static_cast<uint64_t>(objStat.st_size);
+
+        // Zero-length files cannot be mapped, but are still valid (empty) files
+        if (0 < u64SizeBytes) {
+            void* const ptrVoidView = ::mmap(
+                nullptr,
+                static_cast<size_t>(u64SizeBytes),
+                PROT_READ,
+                MAP_PRIVATE,
+                i32Fd,
+                0
+            );
+            if (MAP_FAILED == ptrVoidView) {
+                ::close(i32Fd);
+                u64SizeBytes = 0;
+                return error::enmErrorFileDne;
+            }
+            // Records are decoded front to back, so let the kernel read ahead aggressively
+            ::madvise(ptrVoidView, static_cast<size_t>(u64SizeBytes), MADV_SEQUENTIAL);
+            ptrChrData = static_cast<char const*>(ptrVoidView);
+        }
+
+        // The mapping stays valid after the descriptor is closed
+        ::close(i32Fd);
+#endif
+
+        bIsOpen = true;
+        return error::enmErrorNone;
+    }
+
+    void
+        clsMappedFile::close(
+            void
+        ) {
+#if defined(_WIN32)
+        if (nullptr != ptrChrData) {
+            UnmapViewOfFile(ptrChrData);
+        }
+        if (nullptr != ptrVoidMapHandle) {
+            CloseHandle(static_cast<HANDLE>(ptrVoidMapHandle));
+        }
+        if (nullptr != ptrVoidFileHandle) {
+            CloseHandle(static_cast<HANDLE>(ptrVoidFileHandle));
+        }
+        ptrVoidMapHandle = nullptr;
+        ptrVoidFileHandle = nullptr;
+#else
+        if (nullptr != ptrChrData) {
+            ::munmap(const_cast<char*>(ptrChrData), static_cast<size_t>(u64SizeBytes));
+        }
+#endif
+        bIsOpen = false;
+        ptrChrData = nullptr;
+        u64SizeBytes = 0;
+    }
+
+}
@@ -0,0 +1,109 @@
+/**
+ * @file mappedFile.h
+ * @brief Read-only memory-mapped file and fixed-stride record table views.
+ *
+ * A mapped file exposes its contents directly from the page cache, so fixed-size records (such as
+ * the samples of a binary COMTRADE data file) can be decoded in place without copying them into
+ * an intermediate buffer.
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "error.h"
+#include "types.h"
+
+namespace mf {
+
+    class clsMappedFile {
+
+    public:
+        clsMappedFile() {}
+
+        ~clsMappedFile() {
+            close();
+        }
+
+        // The mapping is owned by exactly one instance
+        clsMappedFile(clsMappedFile const&) = delete;
+        clsMappedFile& operator=(clsMappedFile const&) = delete;
+
+        clsMappedFile(
+            clsMappedFile&& objMfOther
+        ) noexcept;
+
+        clsMappedFile&
+            operator=(
+                clsMappedFile&& objMfOther
+                ) noexcept;
+
+        error::enmErrorType
+            open(
+                std::string const& strFileName
+            );
+
+        void
+            close(
+                void
+            );
+
+        bool
+            isOpen(
+                void
+            ) const {
+            return bIsOpen;
+        }
+
+        char const*
+            data(
+                void
+            ) const {
+            return ptrChrData;
+        }
+
+        uint64_t
+            size(
+                void
+            ) const {
+            return u64SizeBytes;
+        }
+
+    private:
+        bool bIsOpen = false;
+        char const* ptrChrData = nullptr;
+        uint64_t u64SizeBytes = 0;
+
+#if defined(_WIN32)
+        void* ptrVoidFileHandle = nullptr;
+        void* ptrVoidMapHandle = nullptr;
+#endif
+
+    };
+
+    // Table of fixed-size records laid out back-to-back in memory (e.g., within a mapped file)
+    struct stcStrideTableType {
+        char const* ptrChrBase;
+        size_t sizStrideBytes;
+        size_t sizNumRows;
+
+        size_t
+            size(
+                void
+            ) const {
+            return sizNumRows;
+        }
+
+        char const*
+            row(
+                size_t const sizRowIdx
+            ) const {
+            return (ptrChrBase + (sizRowIdx * sizStrideBytes));
+        }
+    };
+
+}
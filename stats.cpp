@@ -0,0 +1,349 @@
+/**
+ * @file stats.cpp
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#include "stats.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "decode.h"
+#include "threadPool.h"
+
+namespace stats {
+
+    namespace {
+
+        void
+            addReduction(
+                decode::stcReductionType const& stcReductionIn,
+                decode::stcReductionType& stcReductionInOut
+            ) {
+            stcReductionInOut.f64Min = std::min(stcReductionInOut.f64Min, stcReductionIn.f64Min);
+            stcReductionInOut.f64Max = std::max(stcReductionInOut.f64Max, stcReductionIn.f64Max);
+            stcReductionInOut.f64Sum += stcReductionIn.f64Sum;
+            stcReductionInOut.f64SumSquares += stcReductionIn.f64SumSquares;
+        }
+
+        // Samples marked missing by the data file
+        uint64_t
+            countMissing(
+                comtrade::enmDataFileFormatType const enmFormat,
+                int32_t const* const ptrI32DataRaw,
+                size_t const sizNumSamples
+            ) {
+            uint64_t u64NumMissing = 0;
+            for (size_t sizIdx = 0; sizNumSamples > sizIdx; ++sizIdx) {
+                u64NumMissing += (comtrade::isMissingValue(enmFormat, ptrI32DataRaw[sizIdx]) ? 1 : 0);
+            }
+            return u64NumMissing;
+        }
+
+        // Reduce a block of samples, leaving out those marked missing if `bSkipMissing` (returns the
+        // number of samples reduced)
+        uint64_t
+            reduceSamples(
+                comtrade::enmDataFileFormatType const enmFormat,
+                bool const bSkipMissing,
+                float64_t const* const ptrF64Data,
+                int32_t const* const ptrI32DataRaw,
+                size_t const sizCount,
+                decode::stcReductionType& stcReductionOut
+            ) {
+            if (!bSkipMissing) {
+                decode::reduceF64(ptrF64Data, sizCount, stcReductionOut);
+                return static_cast<uint64_t>(sizCount);
+            }
+
+            stcReductionOut = decode::stcReductionType{
+                std::numeric_limits<float64_t>::infinity(),
+                -std::numeric_limits<float64_t>::infinity(),
+                0.0,
+                0.0
+            };
+            uint64_t u64NumReduced = 0;
+            for (size_t sizIdx = 0; sizCount > sizIdx; ++sizIdx) {
+                if (comtrade::isMissingValue(enmFormat, ptrI32DataRaw[sizIdx])) {
+                    continue;
+                }
+                float64_t const f64Data = ptrF64Data[sizIdx];
+                stcReductionOut.f64Min = std::min(stcReductionOut.f64Min, f64Data);
+                stcReductionOut.f64Max = std::max(stcReductionOut.f64Max, f64Data);
+                stcReductionOut.f64Sum += f64Data;
+                stcReductionOut.f64SumSquares += (f64Data * f64Data);
+                ++u64NumReduced;
+            }
+            return u64NumReduced;
+        }
+
+        // Samples whose stored value lies at or beyond the configured range (missing ones left out)
+        uint64_t
+            countAtLimit(
+                comtrade::stcConfigFileType const& stcCfg,
+                comtrade::stcAnalogChannelInfoType const& stcAnaChanInfo,
+                int32_t const* const ptrI32DataRaw,
+                size_t const sizNumSamples
+            ) {
+            float64_t const f64RawMin = stcAnaChanInfo.f64RawMin;
+            float64_t const f64RawMax = stcAnaChanInfo.f64RawMax;
+            comtrade::enmDataFileFormatType const enmFormat = stcCfg.enmDataFileFormat;
+            bool const bFloat32 = (comtrade::enmDataFileFormatFloat32 == enmFormat);
+            uint64_t u64NumAtLimit = 0;
+            for (size_t sizIdx = 0; sizNumSamples > sizIdx; ++sizIdx) {
+                if (comtrade::isMissingValue(enmFormat, ptrI32DataRaw[sizIdx])) {
+                    continue;
+                }
+                float64_t f64Raw = static_cast<float64_t>(ptrI32DataRaw[sizIdx]);
+                if (bFloat32) {
+                    float32_t f32Raw = 0.0f;
+                    std::memcpy(&f32Raw, (ptrI32DataRaw + sizIdx), sizeof(float32_t));
+                    f64Raw = f32Raw;
+                }
+                u64NumAtLimit += (((f64RawMin >= f64Raw) || (f64RawMax <= f64Raw)) ? 1 : 0);
+            }
+            return u64NumAtLimit;
+        }
+
+        // Reduce a whole channel, and each cycle of it (returns the number of samples reduced)
+        uint64_t
+            reduceChannel(
+                comtrade::stcConfigFileType const& stcCfg,
+                comtrade::stcDataFileType const& stcDat,
+                size_t const sizChanIdx,
+                stcStatsOptionsType const& stcOpts,
+                bool const bSkipMissing,
+                decode::stcReductionType& stcTotalOut,
+                std::vector<stcCycleRmsType>& vctStcCycleRmsOut
+            ) {
+            comtrade::stcAnalogChannelDataType const& stcAnaChanData = stcDat.vctAnaChanData[sizChanIdx];
+            float64_t const* const ptrF64Data = stcAnaChanData.ptrF64Data;
+            int32_t const* const ptrI32DataRaw = stcAnaChanData.ptrI32DataRaw;
+            size_t const sizNumSamples = static_cast<size_t>(stcDat.u64TotalSamples);
+            uint64_t const u64FirstSampleIdx = stcDat.u64FirstSampleIdx;
+            uint64_t const u64EndSampleIdx = (u64FirstSampleIdx + stcDat.u64TotalSamples);
+            float64_t const f64Frequency = static_cast<float64_t>(stcCfg.f32Frequency);
+            comtrade::enmDataFileFormatType const enmFormat = stcCfg.enmDataFileFormat;
+
+            stcTotalOut = decode::stcReductionType{
+                std::numeric_limits<float64_t>::infinity(),
+                -std::numeric_limits<float64_t>::infinity(),
+                0.0,
+                0.0
+            };
+            decode::stcReductionType stcPart{};
+            size_t sizCovered = 0;
+            uint64_t u64NumReduced = 0;
+            vctStcCycleRmsOut.clear();
+
+            /* Reduce one sampling rate at a time (cycles never span two rates) */
+            for (comtrade::stcSampleSegmentType const& stcSegment : stcCfg.vctSampleSegments) {
+                uint64_t const u64Begin = std::max(stcSegment.u64FirstSampleIdx, u64FirstSampleIdx);
+                uint64_t const u64End = std::min(stcSegment.u64EndSampleIdx, u64EndSampleIdx);
+                if (u64Begin >= u64End) {
+                    continue;
+                }
+                size_t sizAt = static_cast<size_t>(u64Begin - u64FirstSampleIdx);
+                size_t const sizEnd = static_cast<size_t>(u64End - u64FirstSampleIdx);
+
+                // Whole cycles (boundaries rounded to the nearest sample)
+                float64_t const f64SamplesPerCycle = (0.0 < f64Frequency)
+                    ? (stcSegment.f64SamplesPerSec / f64Frequency)
+                    : 0.0;
+                if (stcOpts.bCycleRms && (2.0 <= f64SamplesPerCycle)) {
+                    size_t const sizSegmentBegin = sizAt;
+                    for (uint64_t u64Cycle = 1; ; ++u64Cycle) {
+                        size_t const sizCycleEnd = (sizSegmentBegin + static_cast<size_t>(std::llround(f64SamplesPerCycle * static_cast<float64_t>(u64Cycle))));
+                        if (sizCycleEnd > sizEnd) {
+                            break;
+                        }
+                        uint64_t const u64NumCycleReduced = reduceSamples(
+                            enmFormat,
+                            bSkipMissing,
+                            (ptrF64Data + sizAt),
+                            (ptrI32DataRaw + sizAt),
+                            (sizCycleEnd - sizAt),
+                            stcPart
+                        );
+                        addReduction(stcPart, stcTotalOut);
+                        u64NumReduced += u64NumCycleReduced;
+                        vctStcCycleRmsOut.push_back(stcCycleRmsType{
+                            (u64FirstSampleIdx + sizAt),
+                            static_cast<uint32_t>(sizCycleEnd - sizAt),
+                            (0 == u64NumCycleReduced)
+                                ? std::nan("")
+                                : std::sqrt(stcPart.f64SumSquares / static_cast<float64_t>(u64NumCycleReduced))
+                            });
+                        sizAt = sizCycleEnd;
+                    }
+                }
+
+                // Rest of the rate
+                u64NumReduced += reduceSamples(
+                    enmFormat,
+                    bSkipMissing,
+                    (ptrF64Data + sizAt),
+                    (ptrI32DataRaw + sizAt),
+                    (sizEnd - sizAt),
+                    stcPart
+                );
+                addReduction(stcPart, stcTotalOut);
+                sizCovered = sizEnd;
+            }
+
+            // Samples past the configured rates (e.g., read from a record still being written)
+            if (sizNumSamples > sizCovered) {
+                u64NumReduced += reduceSamples(
+                    enmFormat,
+                    bSkipMissing,
+                    (ptrF64Data + sizCovered),
+                    (ptrI32DataRaw + sizCovered),
+                    (sizNumSamples - sizCovered),
+                    stcPart
+                );
+                addReduction(stcPart, stcTotalOut);
+            }
+            return u64NumReduced;
+        }
+
+        void
+            computeAnalogChannelStats(
+                comtrade::stcConfigFileType const& stcCfg,
+                comtrade::stcDataFileType const& stcDat,
+                size_t const sizChanIdx,
+                stcStatsOptionsType const& stcOpts,
+                stcChannelStatsType& stcStatsOut
+            ) {
+            int32_t const* const ptrI32DataRaw = stcDat.vctAnaChanData[sizChanIdx].ptrI32DataRaw;
+            size_t const sizNumSamples = static_cast<size_t>(stcDat.u64TotalSamples);
+
+            // Samples marked missing (e.g., gaps in the record) are left out of every statistic.
+            // They are NaN once scaled, so the vectorized pass over every sample shows whether there
+            // may be any; only then are they counted, and the channel reduced again sample by sample
+            // without them.
+            decode::stcReductionType stcTotal{};
+            uint64_t u64NumReduced = reduceChannel(stcCfg, stcDat, sizChanIdx, stcOpts, false, stcTotal, stcStatsOut.vctStcCycleRms);
+            stcStatsOut.u64NumMissing = std::isnan(stcTotal.f64Sum)
+                ? countMissing(stcCfg.enmDataFileFormat, ptrI32DataRaw, sizNumSamples)
+                : 0;
+            if (0 != stcStatsOut.u64NumMissing) {
+                u64NumReduced = reduceChannel(stcCfg, stcDat, sizChanIdx, stcOpts, true, stcTotal, stcStatsOut.vctStcCycleRms);
+            }
+
+            /* Summarize (over the samples present) */
+            float64_t const f64NumSamples = static_cast<float64_t>(u64NumReduced);
+            bool const bEmpty = (0 == u64NumReduced);
+            stcStatsOut.f64Min = bEmpty ? std::nan("") : stcTotal.f64Min;
+            stcStatsOut.f64Max = bEmpty ? std::nan("") : stcTotal.f64Max;
+            stcStatsOut.f64Mean = bEmpty ? std::nan("") : (stcTotal.f64Sum / f64NumSamples);
+            stcStatsOut.f64Rms = bEmpty ? std::nan("") : std::sqrt(stcTotal.f64SumSquares / f64NumSamples);
+            stcStatsOut.f64PeakAbs = bEmpty ? std::nan("") : std::max(std::fabs(stcTotal.f64Min), std::fabs(stcTotal.f64Max));
+
+            // Only count samples at the range limits if the extremes come close to one
+            comtrade::stcAnalogChannelInfoType const& stcAnaChanInfo = stcCfg.objVmAnalogChannelInfo[sizChanIdx];
+            comtrade::stcAnalogScalingType const& stcAnaScaling = stcCfg.vctAnaScaling[sizChanIdx];
+            float64_t f64LimitLo = ((stcAnaScaling.f64Mult * stcAnaChanInfo.f64RawMin) + stcAnaScaling.f64Offset);
+            float64_t f64LimitHi = ((stcAnaScaling.f64Mult * stcAnaChanInfo.f64RawMax) + stcAnaScaling.f64Offset);
+            if (f64LimitLo > f64LimitHi) {
+                std::swap(f64LimitLo, f64LimitHi);
+            }
+            float64_t const f64Slack = (1e-9 * (f64LimitHi - f64LimitLo));
+            stcStatsOut.u64NumAtLimit = (
+                (!bEmpty)
+                && (!std::isnan(f64LimitLo))
+                && (!std::isnan(f64LimitHi))
+                && ((stcTotal.f64Min <= (f64LimitLo + f64Slack)) || (stcTotal.f64Max >= (f64LimitHi - f64Slack)))
+                )
+                ? countAtLimit(stcCfg, stcAnaChanInfo, ptrI32DataRaw, sizNumSamples)
+                : 0;
+        }
+
+        // Decode a channel a lazy parse has not decoded yet
+        error::enmErrorType
+            loadAnalogChannel(
+                comtrade::stcConfigFileType const& stcCfg,
+                comtrade::stcDataFileType& stcDat,
+                size_t const sizChanIdx
+            ) {
+            // By index, since names may repeat (a name resolves to the first channel listed under it)
+            comtrade::stcAnalogChannelViewType stcAnaChanView{};
+            error::enmErrorType const enmErrLoad = comtrade::getAnalogChannel(stcCfg, stcDat, sizChanIdx, stcAnaChanView);
+            if (error::enmErrorNone != enmErrLoad) {
+                return enmErrLoad;
+            }
+            comtrade::stcAnalogChannelDataType const& stcAnaChanData = stcDat.vctAnaChanData[sizChanIdx];
+            if ((!stcAnaChanData.bLoaded) || ((nullptr == stcAnaChanData.ptrF64Data) && (0 != stcDat.u64TotalSamples))) {
+                return error::enmErrorInvalidArg;
+            }
+            return error::enmErrorNone;
+        }
+
+    }
+
+    error::enmErrorType
+        computeChannelStats(
+            comtrade::stcConfigFileType const& stcCfg,
+            comtrade::stcDataFileType& stcDat,
+            std::vector<stcChannelStatsType>& vctStcStatsOut,
+            stcStatsOptionsType const& stcOpts
+        ) {
+        if ((!stcCfg.bInit) || (!stcDat.bInit)) {
+            return error::enmErrorInvalidArg;
+        }
+        size_t const sizNumAnaChan = stcDat.vctAnaChanData.size();
+        for (size_t sizChanIdx = 0; sizNumAnaChan > sizChanIdx; ++sizChanIdx) {
+            error::enmErrorType const enmErrLoad = loadAnalogChannel(stcCfg, stcDat, sizChanIdx);
+            if (error::enmErrorNone != enmErrLoad) {
+                return enmErrLoad;
+            }
+        }
+
+        // One task per channel (each reads only its own column and writes only its own result)
+        vctStcStatsOut.resize(sizNumAnaChan);
+        size_t const sizNumThreads = tp::resolveNumThreads(stcOpts.u32NumThreads);
+        auto const fcnComputeChannel = [&](size_t const sizChanIdx) {
+            computeAnalogChannelStats(stcCfg, stcDat, sizChanIdx, stcOpts, vctStcStatsOut[sizChanIdx]);
+        };
+        if ((1 == sizNumThreads) || (1 >= sizNumAnaChan)) {
+            for (size_t sizChanIdx = 0; sizNumAnaChan > sizChanIdx; ++sizChanIdx) {
+                fcnComputeChannel(sizChanIdx);
+            }
+        }
+        else {
+            tp::clsThreadPool::getShared().parallelFor(
+                sizNumAnaChan,
+                sizNumThreads,
+                fcnComputeChannel
+            );
+        }
+        return error::enmErrorNone;
+    }
+
+    error::enmErrorType
+        computeChannelStats(
+            comtrade::stcConfigFileType const& stcCfg,
+            comtrade::stcDataFileType& stcDat,
+            std::string_view const objSvChanName,
+            stcChannelStatsType& stcStatsOut,
+            stcStatsOptionsType const& stcOpts
+        ) {
+        if ((!stcCfg.bInit) || (!stcDat.bInit)) {
+            return error::enmErrorInvalidArg;
+        }
+        size_t const sizChanIdx = stcDat.objVmChanAnaData.find(objSvChanName);
+        if (stcDat.objVmChanAnaData.npos == sizChanIdx) {
+            return error::enmErrorInvalidArg;
+        }
+        error::enmErrorType const enmErrLoad = loadAnalogChannel(stcCfg, stcDat, sizChanIdx);
+        if (error::enmErrorNone != enmErrLoad) {
+            return enmErrLoad;
+        }
+        computeAnalogChannelStats(stcCfg, stcDat, sizChanIdx, stcOpts, stcStatsOut);
+        return error::enmErrorNone;
+    }
+
+}
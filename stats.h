@@ -0,0 +1,86 @@
+/**
+ * @file stats.h
+ * @brief Per-channel summary statistics of parsed analog channels (min, max, mean, RMS, peak, and
+ * RMS per cycle of the mains frequency).
+ *
+ * Each channel is reduced in a single pass with the vectorized kernels of `decode`, and channels
+ * are spread across the shared thread pool.
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include "comtrade.h"
+#include "error.h"
+#include "types.h"
+
+namespace stats {
+
+    // RMS over one cycle of the mains frequency
+    struct stcCycleRmsType {
+        // first sample of the cycle (0-based sample index into the record)
+        uint64_t u64FirstSampleIdx;
+        uint32_t u32NumSamples;
+        // over the samples of the cycle that are not missing (NaN if none are)
+        float64_t f64Rms;
+    };
+
+    // Statistics of one analog channel (in engineering units)
+    //
+    // Samples the data file marks missing (see `comtrade::isMissingValue`) are left out; a channel
+    // without any other samples gets NaN statistics.
+    struct stcChannelStatsType {
+        float64_t f64Min;
+        float64_t f64Max;
+        float64_t f64Mean;
+
+        // true RMS (the DC component included)
+        float64_t f64Rms;
+        float64_t f64PeakAbs;
+
+        // samples at or beyond the range of stored values in the configuration (5.3.3 min, max),
+        // e.g. clipped by the recorder (0 if the range is left blank)
+        uint64_t u64NumAtLimit;
+        // samples left out as missing
+        uint64_t u64NumMissing;
+
+        // whole cycles back to back from the first sample of each sampling rate (none where the
+        // rate is not fixed or gives fewer than two samples per cycle); a partial cycle at the end
+        // of a rate is left out
+        std::vector<stcCycleRmsType> vctStcCycleRms;
+    };
+
+    struct stcStatsOptionsType {
+        // Worker threads the channels are spread across (0 --> one per hardware thread, 1 --> serial)
+        uint32_t u32NumThreads = 0;
+
+        bool bCycleRms = true;
+    };
+
+    // Statistics of every analog channel of a parsed record or slice (indexed by analog channel)
+    //
+    // Channels of a record parsed in lazy mode are decoded first (serially).
+    error::enmErrorType
+        computeChannelStats(
+            comtrade::stcConfigFileType const& stcCfg,
+            comtrade::stcDataFileType& stcDat,
+            std::vector<stcChannelStatsType>& vctStcStatsOut,
+            stcStatsOptionsType const& stcOpts
+        );
+
+    // Statistics of one analog channel (`stcOpts.u32NumThreads` is ignored)
+    error::enmErrorType
+        computeChannelStats(
+            comtrade::stcConfigFileType const& stcCfg,
+            comtrade::stcDataFileType& stcDat,
+            std::string_view const objSvChanName,
+            stcChannelStatsType& stcStatsOut,
+            stcStatsOptionsType const& stcOpts
+        );
+
+}
@@ -0,0 +1,255 @@
+/**
+ * @file synthetic.cpp
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#include "synthetic.h"
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+namespace synth {
+
+    namespace {
+
+        // xorshift64* (small, fast, and identical on every platform)
+        class clsRandom {
+
+        public:
+            explicit clsRandom(
+                uint64_t const u64Seed
+            ) : u64State((u64Seed * 0x9E3779B97F4A7C15ull) | 1) {}
+
+            uint64_t
+                next(
+                    void
+                ) {
+                u64State ^= (u64State >> 12);
+                u64State ^= (u64State << 25);
+                u64State ^= (u64State >> 27);
+                return (u64State * 0x2545F4914F6CDD1Dull);
+            }
+
+        private:
+            uint64_t u64State;
+
+        };
+
+        void
+            appendNumber(
+                std::string& strOut,
+                int64_t const i64Value
+            ) {
+            char arrChrBuf[24];
+            std::to_chars_result const objTcResult = std::to_chars(arrChrBuf, (arrChrBuf + sizeof(arrChrBuf)), i64Value);
+            strOut.append(arrChrBuf, objTcResult.ptr);
+        }
+
+        void
+            appendU16Le(
+                std::string& strOut,
+                uint16_t const u16Value
+            ) {
+            strOut.push_back(static_cast<char>(u16Value & 0xFF));
+            strOut.push_back(static_cast<char>(u16Value >> 8));
+        }
+
+        void
+            appendU32Le(
+                std::string& strOut,
+                uint32_t const u32Value
+            ) {
+            appendU16Le(strOut, static_cast<uint16_t>(u32Value & 0xFFFF));
+            appendU16Le(strOut, static_cast<uint16_t>(u32Value >> 16));
+        }
+
+        error::enmErrorType
+            writeFile(
+                std::string const& strFileName,
+                std::string const& strContents
+            ) {
+            std::ofstream objOfs(strFileName, (std::ios_base::out | std::ios_base::binary | std::ios_base::trunc));
+            if (!objOfs.is_open()) {
+                return error::enmErrorFileDne;
+            }
+            objOfs.write(strContents.data(), static_cast<std::streamsize>(strContents.size()));
+            return objOfs.good() ? error::enmErrorNone : error::enmErrorFileDne;
+        }
+
+    }
+
+    error::enmErrorType
+        writeSyntheticRecord(
+            stcSyntheticRecordType const& stcRecord,
+            std::string const& strFileNamePrefix
+        ) {
+        if (strFileNamePrefix.empty() || stcRecord.vctSamplingRateInfo.empty()) {
+            return error::enmErrorInvalidArg;
+        }
+        if (comtrade::enmDataFileFormatTypeCount <= stcRecord.enmDataFileFormat) {
+            return error::enmErrorNotImpl;
+        }
+        uint64_t u64PrevLastSample = 0;
+        for (comtrade::stcSamplingRateInfoType const& stcRate : stcRecord.vctSamplingRateInfo) {
+            if ((!(0.0 < stcRate.f64SamplesPerSec)) || (u64PrevLastSample >= stcRate.u64LastSampleNumber)) {
+                return error::enmErrorInvalidArg;
+            }
+            u64PrevLastSample = stcRate.u64LastSampleNumber;
+        }
+        uint64_t const u64TotalSamples = u64PrevLastSample;
+        bool const bAscii = (comtrade::enmDataFileFormatAscii == stcRecord.enmDataFileFormat);
+        bool const bBinary32 = (comtrade::enmDataFileFormatBinary32 == stcRecord.enmDataFileFormat);
+        bool const bFloat32 = (comtrade::enmDataFileFormatFloat32 == stcRecord.enmDataFileFormat);
+        char const* const arrPtrChrFormatNames[comtrade::enmDataFileFormatTypeCount] = {
+            "ASCII\r\n",
+            "BINARY\r\n",
+            "BINARY32\r\n",
+            "FLOAT32\r\n"
+        };
+
+        /* Configuration file (5.3) */
+        std::string strCfg;
+        strCfg.append(stcRecord.strStationName).append(",").append(stcRecord.strDeviceId).append(",1999\r\n");
+        appendNumber(strCfg, (stcRecord.u32NumAnaChannels + stcRecord.u32NumDigChannels));
+        strCfg.append(",");
+        appendNumber(strCfg, stcRecord.u32NumAnaChannels);
+        strCfg.append("A,");
+        appendNumber(strCfg, stcRecord.u32NumDigChannels);
+        strCfg.append("D\r\n");
+
+        // Scale full range (16 bit binary, 5 digit ASCII, 32 bit binary) to a few kV or kA; FLOAT32
+        // values are stored in engineering units
+        char const* const arrChrPhases[] = { "A", "B", "C" };
+        for (uint32_t u32Iter = 0; stcRecord.u32NumAnaChannels > u32Iter; ++u32Iter) {
+            bool const bVoltage = (0 == ((u32Iter / 3) % 2));
+            appendNumber(strCfg, (u32Iter + 1));
+            strCfg.append(bVoltage ? ",V" : ",I").append(std::to_string(u32Iter + 1));
+            strCfg.append(",").append(arrChrPhases[u32Iter % 3]).append(",,");
+            strCfg.append(bVoltage ? "kV" : "A");
+            if (bFloat32) {
+                strCfg.append(",1,0,0,-1e6,1e6,1,1,P\r\n");
+            }
+            else if (bBinary32) {
+                strCfg.append(bVoltage ? ",1.52587890625e-07,0" : ",1.52587890625e-06,0");
+                strCfg.append(",0,-2147483647,2147483647,1,1,P\r\n");
+            }
+            else {
+                strCfg.append(bVoltage ? ",0.01,0" : ",0.1,0");
+                strCfg.append(bAscii ? ",0,-99999,99999,1,1,P\r\n" : ",0,-32767,32767,1,1,P\r\n");
+            }
+        }
+        for (uint32_t u32Iter = 0; stcRecord.u32NumDigChannels > u32Iter; ++u32Iter) {
+            appendNumber(strCfg, (u32Iter + 1));
+            strCfg.append(",D").append(std::to_string(u32Iter + 1)).append(",,,0\r\n");
+        }
+
+        strCfg.append(std::to_string(stcRecord.f32Frequency)).append("\r\n");
+        appendNumber(strCfg, static_cast<int64_t>(stcRecord.vctSamplingRateInfo.size()));
+        strCfg.append("\r\n");
+        for (comtrade::stcSamplingRateInfoType const& stcRate : stcRecord.vctSamplingRateInfo) {
+            strCfg.append(std::to_string(stcRate.f64SamplesPerSec)).append(",");
+            appendNumber(strCfg, static_cast<int64_t>(stcRate.u64LastSampleNumber));
+            strCfg.append("\r\n");
+        }
+        strCfg.append("19/04/2023,12:00:00.000000\r\n");
+        strCfg.append("19/04/2023,12:00:00.100000\r\n");
+        strCfg.append(arrPtrChrFormatNames[stcRecord.enmDataFileFormat]);
+        strCfg.append("1\r\n");
+
+        error::enmErrorType enmErrRet = writeFile((strFileNamePrefix + ".CFG"), strCfg);
+        if (error::enmErrorNone != enmErrRet) {
+            return enmErrRet;
+        }
+
+        /* Data file (6.4 ASCII, 6.5 binary) */
+        size_t const sizNumAnaChan = static_cast<size_t>(stcRecord.u32NumAnaChannels);
+        size_t const sizNumDigChan = static_cast<size_t>(stcRecord.u32NumDigChannels);
+        size_t const sizNumWords = ((sizNumDigChan + 15) / 16);
+        size_t const sizAnaValueBytes = ((bBinary32 || bFloat32) ? 4 : 2);
+        // raw values (noise included) span the same share of the full range in every format
+        float64_t const f64RawScale = (bBinary32 ? 65536.0 : 1.0);
+        float64_t const f64Amplitude = ((bAscii ? 90000.0 : 30000.0) * f64RawScale);
+        float64_t const f64TwoPi = 6.283185307179586;
+
+        std::string strDat;
+        strDat.reserve(static_cast<size_t>(u64TotalSamples) * (bAscii
+            ? (24 + (7 * sizNumAnaChan) + (2 * sizNumDigChan))
+            : (4 + 4 + (sizAnaValueBytes * sizNumAnaChan) + (2 * sizNumWords))));
+
+        clsRandom objRandom(stcRecord.u32Seed);
+        std::vector<uint16_t> vctU16Words(sizNumWords, 0);
+        size_t sizRateIdx = 0;
+        float64_t f64TimeUs = 0.0;
+        for (uint64_t u64Sample = 1; u64TotalSamples >= u64Sample; ++u64Sample) {
+            while (stcRecord.vctSamplingRateInfo[sizRateIdx].u64LastSampleNumber < u64Sample) {
+                ++sizRateIdx;
+            }
+            if (1 < u64Sample) {
+                f64TimeUs += (1e6 / stcRecord.vctSamplingRateInfo[sizRateIdx].f64SamplesPerSec);
+            }
+            uint32_t const u32TimeUs = static_cast<uint32_t>(std::llround(f64TimeUs));
+
+            // A few digital channels change state on each sample
+            for (size_t sizIter = 0; sizNumDigChan > sizIter; ++sizIter) {
+                if (0 == (objRandom.next() % 997)) {
+                    vctU16Words[sizIter / 16] ^= static_cast<uint16_t>(1u << (sizIter % 16));
+                }
+            }
+
+            if (bAscii) {
+                appendNumber(strDat, static_cast<int64_t>(u64Sample));
+                strDat.push_back(',');
+                appendNumber(strDat, u32TimeUs);
+            }
+            else {
+                appendU32Le(strDat, static_cast<uint32_t>(u64Sample));
+                appendU32Le(strDat, u32TimeUs);
+            }
+
+            float64_t const f64Angle = (f64TwoPi * stcRecord.f32Frequency * f64TimeUs * 1e-6);
+            for (size_t sizIter = 0; sizNumAnaChan > sizIter; ++sizIter) {
+                float64_t const f64Noise = ((static_cast<float64_t>(objRandom.next() % 2001) - 1000.0) * f64RawScale);
+                float64_t const f64Phase = ((f64TwoPi / 3.0) * static_cast<float64_t>(sizIter % 3));
+                int64_t const i64Value = std::llround((f64Amplitude * std::sin(f64Angle - f64Phase)) + f64Noise);
+                if (bAscii) {
+                    strDat.push_back(',');
+                    appendNumber(strDat, i64Value);
+                }
+                else if (bFloat32) {
+                    // Same waveform as BINARY, scaled into kV or A
+                    bool const bVoltage = (0 == ((sizIter / 3) % 2));
+                    float32_t const f32Value = static_cast<float32_t>(static_cast<float64_t>(i64Value) * (bVoltage ? 0.01 : 0.1));
+                    uint32_t u32Bits = 0;
+                    std::memcpy(&u32Bits, &f32Value, sizeof(u32Bits));
+                    appendU32Le(strDat, u32Bits);
+                }
+                else if (bBinary32) {
+                    appendU32Le(strDat, static_cast<uint32_t>(static_cast<int32_t>(i64Value)));
+                }
+                else {
+                    appendU16Le(strDat, static_cast<uint16_t>(static_cast<int16_t>(i64Value)));
+                }
+            }
+
+            if (bAscii) {
+                for (size_t sizIter = 0; sizNumDigChan > sizIter; ++sizIter) {
+                    strDat.push_back(',');
+                    strDat.push_back(((vctU16Words[sizIter / 16] >> (sizIter % 16)) & 1) ? '1' : '0');
+                }
+                strDat.append("\r\n");
+            }
+            else {
+                for (uint16_t const u16Word : vctU16Words) {
+                    appendU16Le(strDat, u16Word);
+                }
+            }
+        }
+
+        return writeFile((strFileNamePrefix + ".DAT"), strDat);
+    }
+
+}
@@ -0,0 +1,47 @@
+/**
+ * @file synthetic.h
+ * @brief Deterministic generator of synthetic COMTRADE records (for benchmarking and profiling).
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "comtrade.h"
+#include "error.h"
+#include "types.h"
+
+namespace synth {
+
+    // Shape of a synthetic record
+    //
+    // Analog channels are phase-shifted sine waves at `f32Frequency` plus seeded noise; digital
+    // channels are seeded random steps. The same description always yields the same bytes.
+    struct stcSyntheticRecordType {
+        std::string strStationName = "SYNTHETIC";
+        std::string strDeviceId = "GENERATOR";
+
+        uint32_t u32NumAnaChannels = 8;
+        uint32_t u32NumDigChannels = 16;
+
+        // 5.3.5 --> samp, endsamp (per sampling rate; endsamp counts from the start of the record)
+        std::vector<comtrade::stcSamplingRateInfoType> vctSamplingRateInfo{ { 4000.0, 100000 } };
+
+        comtrade::enmDataFileFormatType enmDataFileFormat = comtrade::enmDataFileFormatBinary;
+        float32_t f32Frequency = 60.0f;
+
+        uint32_t u32Seed = 1;
+    };
+
+    // Write `<strFileNamePrefix>.CFG` and `<strFileNamePrefix>.DAT` for the described record
+    error::enmErrorType
+        writeSyntheticRecord(
+            stcSyntheticRecordType const& stcRecord,
+            std::string const& strFileNamePrefix
+        );
+
+}
@@ -0,0 +1,211 @@
+/**
+ * @file threadPool.cpp
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#include "threadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace tp {
+
+    namespace {
+
+        // Private variables
+
+        // Pool and index of the worker running on this thread (nullptr on other threads)
+        thread_local clsThreadPool const* ptrObjCurrentPool = nullptr;
+        thread_local size_t sizCurrentWorkerIdx = 0;
+
+        // Private types
+
+        // Shared between the caller of `parallelFor` and its helper tasks
+        struct stcParallelForStateType {
+            std::function<void(size_t)> const* ptrFcnTask;
+            size_t sizNumTasks;
+            std::atomic<size_t> objAtmNextTask{ 0 };
+            std::atomic<size_t> objAtmDoneTasks{ 0 };
+            std::mutex objMtxDone;
+            std::condition_variable objCvDone;
+        };
+
+        // Private functions
+
+        void
+            drainParallelFor(
+                stcParallelForStateType& stcState
+            ) {
+            size_t sizTaskIdx = 0;
+            while (stcState.sizNumTasks > (sizTaskIdx = stcState.objAtmNextTask.fetch_add(1))) {
+                (*stcState.ptrFcnTask)(sizTaskIdx);
+                if (stcState.sizNumTasks == (1 + stcState.objAtmDoneTasks.fetch_add(1))) {
+                    std::lock_guard<std::mutex> const objLock(stcState.objMtxDone);
+                    stcState.objCvDone.notify_all();
+                }
+            }
+        }
+
+    }
+
+    clsThreadPool::clsThreadPool(
+        size_t const sizNumThreads
+    ) {
+        size_t const sizNumWorkers = std::max(static_cast<size_t>(1), sizNumThreads);
+        vctPtrStcWorkerQueues.reserve(sizNumWorkers);
+        for (size_t sizIter = 0; sizNumWorkers > sizIter; ++sizIter) {
+            vctPtrStcWorkerQueues.push_back(std::make_unique<stcTaskQueueType>());
+        }
+        vctObjWorkers.reserve(sizNumWorkers);
+        for (size_t sizIter = 0; sizNumWorkers > sizIter; ++sizIter) {
+            vctObjWorkers.emplace_back([this, sizIter]() { runWorker(sizIter); });
+        }
+    }
+
+    clsThreadPool::~clsThreadPool() {
+        {
+            std::lock_guard<std::mutex> const objLock(objMtxQueue);
+            bStopping = true;
+        }
+        objCvQueue.notify_all();
+        for (std::thread& objThread : vctObjWorkers) {
+            objThread.join();
+        }
+    }
+
+    void
+        clsThreadPool::submit(
+            std::function<void(void)> fcnTask
+        ) {
+        stcTaskQueueType& stcQueue = (this == ptrObjCurrentPool)
+            ? *vctPtrStcWorkerQueues[sizCurrentWorkerIdx]
+            : stcSharedQueue;
+        {
+            // Counted once queued (under the queue lock, so it is never taken before it is counted);
+            // a worker woken by the count then always finds the task instead of spinning on it
+            std::lock_guard<std::mutex> const objLock(stcQueue.objMtx);
+            stcQueue.dqFcnTasks.push_back(std::move(fcnTask));
+            objAtmNumQueued.fetch_add(1);
+        }
+
+        // Lock so the wake-up cannot fall between a worker's check and its wait
+        {
+            std::lock_guard<std::mutex> const objLock(objMtxQueue);
+        }
+        objCvQueue.notify_one();
+    }
+
+    void
+        clsThreadPool::parallelFor(
+            size_t const sizNumTasks,
+            size_t const sizMaxConcurrency,
+            std::function<void(size_t)> const& fcnTask
+        ) {
+        if (0 == sizNumTasks) {
+            return;
+        }
+
+        std::shared_ptr<stcParallelForStateType> const ptrStcState = std::make_shared<stcParallelForStateType>();
+        ptrStcState->ptrFcnTask = &fcnTask;
+        ptrStcState->sizNumTasks = sizNumTasks;
+
+        // Helpers that start after all tasks are claimed return immediately
+        size_t const sizNumHelpers = std::min(
+            (sizNumTasks - 1),
+            std::min(size(), (std::max(static_cast<size_t>(1), sizMaxConcurrency) - 1))
+        );
+        for (size_t sizIter = 0; sizNumHelpers > sizIter; ++sizIter) {
+            submit([ptrStcState]() { drainParallelFor(*ptrStcState); });
+        }
+
+        drainParallelFor(*ptrStcState);
+
+        std::unique_lock<std::mutex> objLock(ptrStcState->objMtxDone);
+        ptrStcState->objCvDone.wait(
+            objLock,
+            [&ptrStcState]() { return (ptrStcState->sizNumTasks == ptrStcState->objAtmDoneTasks.load()); }
+        );
+    }
+
+    clsThreadPool&
+        clsThreadPool::getShared(
+            void
+        ) {
+        static clsThreadPool objTpShared(resolveNumThreads(0));
+        return objTpShared;
+    }
+
+    void
+        clsThreadPool::runWorker(
+            size_t const sizWorkerIdx
+        ) {
+        ptrObjCurrentPool = this;
+        sizCurrentWorkerIdx = sizWorkerIdx;
+
+        while (true) {
+            std::function<void(void)> fcnTask;
+            if (tryTakeTask(sizWorkerIdx, fcnTask)) {
+                fcnTask();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> objLock(objMtxQueue);
+            objCvQueue.wait(objLock, [this]() { return (bStopping || (0 != objAtmNumQueued.load())); });
+            if (0 == objAtmNumQueued.load()) {
+                // Stopping, and nothing left to run
+                return;
+            }
+        }
+    }
+
+    bool
+        clsThreadPool::tryTakeTask(
+            size_t const sizWorkerIdx,
+            std::function<void(void)>& fcnTaskOut
+        ) {
+        if (0 == objAtmNumQueued.load()) {
+            return false;
+        }
+
+        size_t const sizNumWorkers = vctPtrStcWorkerQueues.size();
+        for (size_t sizIter = 0; (1 + sizNumWorkers) > sizIter; ++sizIter) {
+            // Own deque first (newest task), then the shared queue, then the other workers
+            // (oldest task) starting with the next one along
+            bool const bOwn = (0 == sizIter);
+            stcTaskQueueType& stcQueue = bOwn
+                ? *vctPtrStcWorkerQueues[sizWorkerIdx]
+                : ((1 == sizIter) ? stcSharedQueue : *vctPtrStcWorkerQueues[(sizWorkerIdx + sizIter - 1) % sizNumWorkers]);
+
+            std::lock_guard<std::mutex> const objLock(stcQueue.objMtx);
+            if (stcQueue.dqFcnTasks.empty()) {
+                continue;
+            }
+            if (bOwn) {
+                fcnTaskOut = std::move(stcQueue.dqFcnTasks.back());
+                stcQueue.dqFcnTasks.pop_back();
+            }
+            else {
+                fcnTaskOut = std::move(stcQueue.dqFcnTasks.front());
+                stcQueue.dqFcnTasks.pop_front();
+            }
+            objAtmNumQueued.fetch_sub(1);
+            return true;
+        }
+        return false;
+    }
+
+    size_t
+        resolveNumThreads(
+            uint32_t const u32NumThreads
+        ) {
+        if (0 != u32NumThreads) {
+            return static_cast<size_t>(u32NumThreads);
+        }
+        return std::max(static_cast<size_t>(1), static_cast<size_t>(std::thread::hardware_concurrency()));
+    }
+
+}
@@ -0,0 +1,112 @@
+/**
+ * @file threadPool.h
+ * @brief Fixed-size, work-stealing pool of worker threads for running independent tasks in parallel.
+ *
+ * Each worker has its own task deque: tasks submitted from a worker go to the back of its deque
+ * and it runs them newest first, while idle workers steal the oldest task from the front of
+ * another worker's deque. Tasks submitted from other threads go through a shared queue. The pieces
+ * of a task that splits its work (e.g., `parallelFor` in a large parse) so stay with its worker
+ * until another worker runs out of work.
+ *
+ * @author Adam King
+ * @date 2023-04-19
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tp {
+
+    class clsThreadPool {
+
+    public:
+        explicit clsThreadPool(
+            size_t const sizNumThreads
+        );
+
+        ~clsThreadPool();
+
+        clsThreadPool(clsThreadPool const&) = delete;
+        clsThreadPool& operator=(clsThreadPool const&) = delete;
+
+        // worker count
+        size_t
+            size(
+                void
+            ) const {
+            return vctObjWorkers.size();
+        }
+
+        // queue a task to run on any worker (on the calling worker's own deque if called from a task)
+        void
+            submit(
+                std::function<void(void)> fcnTask
+            );
+
+        // run `fcnTask(0)` through `fcnTask(sizNumTasks - 1)` and block until all have finished
+        //
+        // The calling thread takes part in the work, so this is safe to call from within a task,
+        // and at most `sizMaxConcurrency` threads (including the caller) run tasks at once.
+        void
+            parallelFor(
+                size_t const sizNumTasks,
+                size_t const sizMaxConcurrency,
+                std::function<void(size_t)> const& fcnTask
+            );
+
+        // process-wide pool with one worker per hardware thread
+        static clsThreadPool&
+            getShared(
+                void
+            );
+
+    private:
+        struct stcTaskQueueType {
+            std::mutex objMtx;
+            std::deque<std::function<void(void)>> dqFcnTasks;
+        };
+
+        void
+            runWorker(
+                size_t const sizWorkerIdx
+            );
+
+        // Pop from the worker's own deque (back), then the shared queue, then steal (front)
+        bool
+            tryTakeTask(
+                size_t const sizWorkerIdx,
+                std::function<void(void)>& fcnTaskOut
+            );
+
+        // Sleeping workers wait for `objAtmNumQueued` (tasks queued anywhere) to become non-zero
+        std::mutex objMtxQueue;
+        std::condition_variable objCvQueue;
+        std::atomic<size_t> objAtmNumQueued{ 0 };
+        bool bStopping = false;
+
+        // Tasks submitted from outside the pool
+        stcTaskQueueType stcSharedQueue;
+        // One deque per worker
+        std::vector<std::unique_ptr<stcTaskQueueType>> vctPtrStcWorkerQueues;
+
+        std::vector<std::thread> vctObjWorkers;
+
+    };
+
+    // Thread count of a `u32NumThreads` option (0 --> one per hardware thread; at least 1)
+    size_t
+        resolveNumThreads(
+            uint32_t const u32NumThreads
+        );
+
+}
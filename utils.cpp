@@ -7,6 +7,7 @@
 
 #include "utils.h"
 
+#include <cctype>
 #include <cstddef>
 
 namespace utils {
@@ -32,6 +33,18 @@ namespace utils {
         return error::enmErrorNone;
     }
 
+    error::enmErrorType
+        openFile(
+            std::string const strFileName,
+            mf::clsMappedFile& objMfOut
+        ) {
+        if (strFileName.empty()) {
+            return error::enmErrorInvalidArg;
+        }
+
+        return objMfOut.open(strFileName);
+    }
+
     error::enmErrorType
         trimWhitespace(
             std::string const strIn,
@@ -96,6 +109,110 @@ namespace utils {
         return error::enmErrorNone;
     }
 
+    std::string_view
+        trimWhitespace(
+            std::string_view const objSvIn
+        ) {
+        std::size_t sizBegin = 0;
+        std::size_t sizEnd = objSvIn.size();
+
+        // Remove leading whitespace
+        while ((sizBegin < sizEnd) && std::isspace(static_cast<unsigned char>(objSvIn[sizBegin]))) {
+            ++sizBegin;
+        }
+
+        // Remove trailing whitespace
+        while ((sizBegin < sizEnd) && std::isspace(static_cast<unsigned char>(objSvIn[sizEnd - 1]))) {
+            --sizEnd;
+        }
+
+        return objSvIn.substr(sizBegin, (sizEnd - sizBegin));
+    }
+
+    bool
+        popLine(
+            std::string_view& objSvBufInOut,
+            std::string_view& objSvLineOut
+        ) {
+        if (objSvBufInOut.empty()) {
+            return false;
+        }
+
+        std::size_t const sizEol = objSvBufInOut.find('\n');
+        if (std::string_view::npos == sizEol) {
+            // Final line is unterminated
+            objSvLineOut = objSvBufInOut;
+            objSvBufInOut.remove_prefix(objSvBufInOut.size());
+        }
+        else {
+            objSvLineOut = objSvBufInOut.substr(0, sizEol);
+            objSvBufInOut.remove_prefix(sizEol + 1);
+        }
+
+        // Tolerate DOS line endings
+        if ((!objSvLineOut.empty()) && ('\r' == objSvLineOut.back())) {
+            objSvLineOut.remove_suffix(1);
+        }
+        return true;
+    }
+
+    bool
+        popToken(
+            std::string_view& objSvLineInOut,
+            char const chrDelim,
+            std::string_view& objSvTokenOut
+        ) {
+        // A default-constructed view marks a line with no tokens left (an empty line still has one)
+        if (nullptr == objSvLineInOut.data()) {
+            return false;
+        }
+
+        std::size_t const sizDelim = objSvLineInOut.find(chrDelim);
+        if (std::string_view::npos == sizDelim) {
+            objSvTokenOut = trimWhitespace(objSvLineInOut);
+            objSvLineInOut = std::string_view{};
+        }
+        else {
+            objSvTokenOut = trimWhitespace(objSvLineInOut.substr(0, sizDelim));
+            objSvLineInOut.remove_prefix(sizDelim + 1);
+        }
+        return true;
+    }
+
+    char const*
+        scanI64(
+            char const* const ptrChrBegin,
+            char const* const ptrChrEnd,
+            int64_t& i64Out
+        ) {
+        char const* ptrChrAt = ptrChrBegin;
+
+        bool bNegative = false;
+        if ((ptrChrEnd > ptrChrAt) && (('-' == *ptrChrAt) || ('+' == *ptrChrAt))) {
+            bNegative = ('-' == *ptrChrAt);
+            ++ptrChrAt;
+        }
+
+        // At most 18 digits, so the accumulator can never overflow
+        char const* const ptrChrDigits = ptrChrAt;
+        char const* const ptrChrLimit = ((ptrChrEnd - ptrChrAt) > 18) ? (ptrChrAt + 18) : ptrChrEnd;
+        uint64_t u64Value = 0;
+        while ((ptrChrLimit > ptrChrAt) && (static_cast<uint8_t>(*ptrChrAt - '0') < 10)) {
+            u64Value = (u64Value * 10) + static_cast<uint8_t>(*ptrChrAt - '0');
+            ++ptrChrAt;
+        }
+        if (
+            (ptrChrDigits == ptrChrAt)
+            || ((ptrChrEnd > ptrChrAt) && (static_cast<uint8_t>(*ptrChrAt - '0') < 10))
+            ) {
+            // No digits, or too many digits
+            return nullptr;
+        }
+
+        i64Out = bNegative ? -static_cast<int64_t>(u64Value) : static_cast<int64_t>(u64Value);
+        return ptrChrAt;
+    }
+
     uint8_t
         popU8Le(
             char const*& ptrChrBufIn
@@ -8,11 +8,15 @@
 
 #pragma once
 
+#include <charconv>
 #include <fstream>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include <vector>
 
 #include "error.h"
+#include "mappedFile.h"
 #include "types.h"
 
 namespace utils {
@@ -24,6 +28,12 @@ namespace utils {
             std::ifstream& objIfsOut
         );
 
+    error::enmErrorType
+        openFile(
+            std::string const strFileName,
+            mf::clsMappedFile& objMfOut
+        );
+
     error::enmErrorType
         trimWhitespace(
             std::string const strIn,
@@ -37,6 +47,59 @@ namespace utils {
             std::vector<std::string>& vctStrOut
         );
 
+    // Whitespace-trimmed view of `objSvIn` (no copy)
+    std::string_view
+        trimWhitespace(
+            std::string_view const objSvIn
+        );
+
+    // Split the next line off the front of `objSvBufInOut`, without its line ending
+    //
+    // Returns false once `objSvBufInOut` is exhausted
+    bool
+        popLine(
+            std::string_view& objSvBufInOut,
+            std::string_view& objSvLineOut
+        );
+
+    // Split the next whitespace-trimmed token off the front of `objSvLineInOut`
+    //
+    // A trailing delimiter yields a final empty token; returns false once no tokens remain
+    bool
+        popToken(
+            std::string_view& objSvLineInOut,
+            char const chrDelim,
+            std::string_view& objSvTokenOut
+        );
+
+    // Parse a whole token as a number (locale-independent, no allocation, leading `+` allowed)
+    template <typename typNumType>
+    error::enmErrorType
+        parseNumber(
+            std::string_view objSvIn,
+            typNumType& typNumOut
+        ) {
+        if ((!objSvIn.empty()) && ('+' == objSvIn.front())) {
+            objSvIn.remove_prefix(1);
+        }
+        char const* const ptrChrEnd = (objSvIn.data() + objSvIn.size());
+        std::from_chars_result const objFcResult = std::from_chars(objSvIn.data(), ptrChrEnd, typNumOut);
+        if ((std::errc{} != objFcResult.ec) || (ptrChrEnd != objFcResult.ptr)) {
+            return error::enmErrorInvalidArg;
+        }
+        return error::enmErrorNone;
+    }
+
+    // Parse an optionally signed decimal integer starting exactly at `ptrChrBegin`
+    //
+    // Returns a pointer one past the last character consumed, or `nullptr` if no integer was found
+    char const*
+        scanI64(
+            char const* const ptrChrBegin,
+            char const* const ptrChrEnd,
+            int64_t& i64Out
+        );
+
     uint8_t
         popU8Le(
             char const*& ptrChrBufIn
@@ -13,34 +13,76 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
-#include <unordered_map>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 namespace vm {
 
+	// Keys and values are stored contiguously in insertion order and indexed by a flat,
+	// open-addressing (linear probing) table of element indices, so a lookup touches one small
+	// array plus the matching key. String-like keys can be looked up by `std::string_view`
+	// without building a temporary key, and a resolved index stays valid until `clear()`.
 	template<typename typKeyType, typename typValueType>
 	class clsVectorMap {
 
 	public:
+		// `find()` result for a missing key
+		static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
 		clsVectorMap() {}
 
+		// append an element (a duplicate key is stored, but lookups keep finding the first one)
 		void
 			insert(
-				typKeyType const typKey,
-				typValueType const typValue
+				typKeyType const& typKey,
+				typValueType const& typValue
+			) {
+			size_t const sizHash = getHash(typKey);
+			size_t const sizVctIdx = vctValues.size();
+			if (npos == findHashed(typKey, sizHash)) {
+				reserveSlots(sizVctIdx + 1);
+				insertSlot(sizHash, sizVctIdx);
+			}
+			vctKeys.push_back(typKey);
+			vctValues.push_back(typValue);
+			vctSizHashes.push_back(sizHash);
+		}
+
+		// pre-allocate room for `sizNumElements` elements
+		void
+			reserve(
+				std::size_t const sizNumElements
+			) {
+			vctKeys.reserve(sizNumElements);
+			vctValues.reserve(sizNumElements);
+			vctSizHashes.reserve(sizNumElements);
+			reserveSlots(sizNumElements);
+		}
+
+		// remove all elements (keeps allocated capacity)
+		void
+			clear(
+				void
 			) {
-			size_t const sizVctIdx = vctInternal.size();
-			vctInternal.push_back(typValue);
-			mapInternal.insert({ typKey, sizVctIdx });
+			vctKeys.clear();
+			vctValues.clear();
+			vctSizHashes.clear();
+			std::fill(vctU32Slots.begin(), vctU32Slots.end(), static_cast<uint32_t>(0));
 		}
 
 		// key count (map)
+		template<typename typLookupType>
 		size_t
 			count(
-				typKeyType const typKey
+				typLookupType const& typKey
 			) const {
-			return mapInternal.count(typKey);
+			return (npos == find(typKey)) ? 0 : 1;
 		}
 
 		// element count (vector)
@@ -48,28 +90,150 @@ namespace vm {
 			size(
 				void
 			) const {
-			return vctInternal.size();
+			return vctValues.size();
 		}
 
 		// indexing
-		typValueType
+		typValueType const&
 			operator[] (
 				std::size_t const sizIndex
 				) const {
-			return vctInternal.at(sizIndex);
+			return vctValues.at(sizIndex);
 		}
 
 		// lookup
-		typValueType
+		typValueType const&
+			operator[] (
+				typKeyType const& typKey
+				) const {
+			return vctValues[index(typKey)];
+		}
+
+		// lookup by any key type comparable to `typKeyType` (e.g., `std::string_view`)
+		template<typename typLookupType, typename = std::enable_if_t<!std::is_integral<typLookupType>::value>>
+		typValueType const&
 			operator[] (
-				typKeyType const typKey
+				typLookupType const& typKey
 				) const {
-			return vctInternal.at(mapInternal.at(typKey));
+			return vctValues[index(typKey)];
+		}
+
+		// key --> index (throws `std::out_of_range` if missing)
+		template<typename typLookupType>
+		size_t
+			index(
+				typLookupType const& typKey
+			) const {
+			size_t const sizIndex = find(typKey);
+			if (npos == sizIndex) {
+				throw std::out_of_range("vm::clsVectorMap: key not found");
+			}
+			return sizIndex;
+		}
+
+		// key --> index (`npos` if missing)
+		template<typename typLookupType>
+		size_t
+			find(
+				typLookupType const& typKey
+			) const {
+			return findHashed(typKey, getHash(typKey));
+		}
+
+		// index --> key
+		typKeyType const&
+			key(
+				std::size_t const sizIndex
+			) const {
+			return vctKeys.at(sizIndex);
+		}
+
+		// in-place update (indexing)
+		typValueType&
+			at(
+				std::size_t const sizIndex
+			) {
+			return vctValues.at(sizIndex);
 		}
 
 	private:
-		std::unordered_map<typKeyType, size_t> mapInternal;
-		std::vector<typValueType> vctInternal;
+		template<typename typLookupType>
+		static size_t
+			getHash(
+				typLookupType const& typKey
+			) {
+			// `std::hash<std::string>` and `std::hash<std::string_view>` agree on equal text
+			if constexpr (std::is_convertible<typLookupType const&, std::string_view>::value) {
+				return std::hash<std::string_view>{}(std::string_view(typKey));
+			}
+			else {
+				return std::hash<typKeyType>{}(typKey);
+			}
+		}
+
+		template<typename typLookupType>
+		size_t
+			findHashed(
+				typLookupType const& typKey,
+				size_t const sizHash
+			) const {
+			if (vctU32Slots.empty()) {
+				return npos;
+			}
+			size_t const sizMask = (vctU32Slots.size() - 1);
+			for (size_t sizSlot = (sizHash & sizMask); ; sizSlot = ((sizSlot + 1) & sizMask)) {
+				uint32_t const u32Entry = vctU32Slots[sizSlot];
+				if (0 == u32Entry) {
+					return npos;
+				}
+				size_t const sizIndex = static_cast<size_t>(u32Entry - 1);
+				if ((sizHash == vctSizHashes[sizIndex]) && (vctKeys[sizIndex] == typKey)) {
+					return sizIndex;
+				}
+			}
+		}
+
+		void
+			insertSlot(
+				size_t const sizHash,
+				size_t const sizIndex
+			) {
+			size_t const sizMask = (vctU32Slots.size() - 1);
+			size_t sizSlot = (sizHash & sizMask);
+			while (0 != vctU32Slots[sizSlot]) {
+				sizSlot = ((sizSlot + 1) & sizMask);
+			}
+			vctU32Slots[sizSlot] = static_cast<uint32_t>(sizIndex + 1);
+		}
+
+		void
+			reserveSlots(
+				size_t const sizNumElements
+			) {
+			// Keep the table at most half full (power-of-two size, so probing can mask)
+			size_t sizNumSlots = 16;
+			while (sizNumSlots < (2 * sizNumElements)) {
+				sizNumSlots *= 2;
+			}
+			if (sizNumSlots <= vctU32Slots.size()) {
+				return;
+			}
+
+			// Rehash from the stored hashes (first occurrence of each key only)
+			vctU32Slots.assign(sizNumSlots, 0);
+			for (size_t sizIndex = 0; vctKeys.size() > sizIndex; ++sizIndex) {
+				if (npos == findHashed(vctKeys[sizIndex], vctSizHashes[sizIndex])) {
+					insertSlot(vctSizHashes[sizIndex], sizIndex);
+				}
+			}
+		}
+
+		std::vector<typKeyType> vctKeys;
+		std::vector<typValueType> vctValues;
+		std::vector<size_t> vctSizHashes;
+
+		// 0 --> empty, otherwise (element index + 1)
+		std::vector<uint32_t> vctU32Slots;
 
 	};
 